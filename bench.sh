@@ -0,0 +1,78 @@
+#!/bin/bash
+# Compiles generated workloads at several thread counts, writing the
+# wall time, the time of each phase and the peak memory to a TSV file.
+# If a baseline exists, prints the ratio of each result to it.
+#
+# Run through 'make bench'. 'make bench-baseline' stores the results
+# as the new baseline. To compare against another commit, build its
+# bench_compiler and run this with BENCH_COMPILER naming it first.
+
+set -e
+
+BENCH_DIR=${BENCH_DIR:-bench}
+BENCH_JOBS=${BENCH_JOBS:-"1 2 4 8"}
+BENCH_RUNS=${BENCH_RUNS:-3}
+BENCH_COMPILER=${BENCH_COMPILER:-./bench_compiler}
+RESULTS=$BENCH_DIR/results.tsv
+BASELINE=$BENCH_DIR/baseline.tsv
+
+# name, then the workload_gen flags.
+WORKLOADS=(
+  "small  --fns 200 --vars 50 --files 4"
+  "wide   --fns 4000 --vars 500 --files 32 --depth 4 --fanout 4"
+  "deep   --fns 2000 --vars 200 --files 16 --depth 64 --fanout 2"
+  "loops  --fns 1000 --vars 200 --files 8 --stmts 60 --loop-depth 4 --branches 40"
+  "fixed  --fns 1000 --vars 200 --files 8 --fixed 100"
+  "big    --fns 20000 --vars 2000 --files 64"
+)
+
+mkdir -p "$BENCH_DIR"
+printf 'workload\tjobs\twall_ms\tparse_ms\torder_ms\tcompile_ms\tpeak_kib\n' > "$RESULTS"
+
+for workload in "${WORKLOADS[@]}"; do
+  read -r name flags <<< "$workload"
+  dir=$BENCH_DIR/$name
+  rm -rf "$dir"
+  mkdir -p "$dir"
+  ./workload_gen $flags "$dir"
+
+  for jobs in $BENCH_JOBS; do
+    # Keeps the fastest of the runs, as it's the least noisy.
+    best=
+    for ((run = 0; run < BENCH_RUNS; ++run)); do
+      begin=$(date +%s%N)
+      out=$("$BENCH_COMPILER" -j "$jobs" --time-report --report-memory "$dir"/*.mos)
+      end=$(date +%s%N)
+      wall=$(( (end - begin) / 1000000 ))
+      row=$(awk -v wall="$wall" '
+        /^  parse phase /   { parse = $(NF-1) }
+        /^  order phase /   { order = $(NF-1) }
+        /^  compile phase / { compile = $(NF-1) }
+        /^Peak memory: /    { peak = $3 }
+        END { printf "%d\t%.3f\t%.3f\t%.3f\t%d", wall, parse, order, compile, peak }
+      ' <<< "$out")
+      if [[ -z $best || $wall -lt ${best%%$'\t'*} ]]; then
+        best=$row
+      fi
+    done
+    printf '%s\t%s\t%s\n' "$name" "$jobs" "$best" | tee -a "$RESULTS"
+  done
+done
+
+if [[ -f $BASELINE ]]; then
+  echo
+  echo "Compared to $BASELINE (new / old):"
+  awk -F '\t' '
+    NR == FNR { if(FNR > 1) base[$1 "\t" $2] = $0; next }
+    FNR == 1 { print; next }
+    {
+      key = $1 "\t" $2
+      if(!(key in base)) { print $0 "\t(no baseline)"; next }
+      split(base[key], old, "\t")
+      line = $1 "\t" $2
+      for(i = 3; i <= NF; ++i)
+        line = line "\t" (old[i] > 0 ? sprintf("%.2f", $i / old[i]) : "-")
+      print line
+    }
+  ' "$BASELINE" "$RESULTS"
+fi
@@ -134,6 +134,19 @@ public:
 
     std::size_t size() const { return used_size; }
 
+    // The bytes held by the pool, including buffers kept for reuse.
+    std::size_t capacity_bytes() const
+    {
+        std::size_t bytes = 0;
+        for(buffer_t* buffer = used.get(); buffer; buffer = buffer->prev.get())
+            bytes += sizeof(buffer_t);
+        for(buffer_t* buffer = free.get(); buffer; buffer = buffer->prev.get())
+            bytes += sizeof(buffer_t);
+        for(auto const& vec : oversized)
+            bytes += vec.capacity() * sizeof(T);
+        return bytes;
+    }
+
 private:
     using storage_t = 
         typename std::aligned_storage<sizeof(T), alignof(T)>::type;
@@ -0,0 +1,97 @@
+#include "atom.hpp"
+
+#include <array>
+#include <cassert>
+#include <mutex>
+#include <vector>
+
+#include "robin/table.hpp"
+
+#include "array_pool.hpp"
+
+namespace
+{
+    // The table is split into shards, each with its own lock,
+    // so that parser threads rarely contend.
+    // The top bits of the hash pick the shard, while the low bits of the
+    // atom record it, so that shards can hand out atoms independently.
+    constexpr unsigned shard_bits = 6;
+    constexpr unsigned num_shards = 1 << shard_bits;
+
+    struct alignas(64) shard_t
+    {
+        std::mutex mutex;
+        rh::robin_auto_table<atom_ht> map;
+        std::vector<std::string_view> names; // Points into 'chars'.
+        array_pool_t<char, 4096> chars;
+    };
+
+    std::array<shard_t, num_shards> shards;
+
+    unsigned shard_index(atom_ht atom)
+        { return atom.value & (num_shards - 1); }
+    unsigned name_index(atom_ht atom)
+        { return (atom.value >> shard_bits) - 1; }
+
+    // Most identifiers repeat within a file, so each thread keeps a
+    // small direct-mapped cache in front of the shared table.
+    struct cache_entry_t
+    {
+        atom_hash_t hash;
+        atom_ht atom;
+        std::string_view name;
+    };
+
+    constexpr unsigned cache_size = 1024; // Must be power of 2.
+    thread_local std::array<cache_entry_t, cache_size> cache = {};
+} // end anon namespace
+
+atom_ht intern(std::string_view name, atom_hash_t hash)
+{
+    assert(hash == atom_hash(name.data(), name.data() + name.size()));
+
+    cache_entry_t& entry = cache[hash & (cache_size - 1)];
+    if(entry.hash == hash && entry.name == name)
+        return entry.atom;
+
+    unsigned const shard_i = hash >> (sizeof(atom_hash_t) * 8 - shard_bits);
+    shard_t& shard = shards[shard_i];
+
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    atom_ht const atom = *shard.map.emplace(hash,
+        [&](atom_ht atom) -> bool
+        {
+            return shard.names[name_index(atom)] == name;
+        },
+        [&]() -> atom_ht
+        {
+            char const* chars = shard.chars.insert(name.begin(), name.end());
+            shard.names.emplace_back(chars, name.size());
+            return { (shard.names.size() << shard_bits) | shard_i };
+        }).first;
+
+    entry = { hash, atom, shard.names[name_index(atom)] };
+    return atom;
+}
+
+std::string_view atom_name(atom_ht atom)
+{
+    assert(atom);
+    shard_t& shard = shards[shard_index(atom)];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    assert(name_index(atom) < shard.names.size());
+    return shard.names[name_index(atom)];
+}
+
+std::size_t atom_memory_size()
+{
+    std::size_t size = 0;
+    for(shard_t& shard : shards)
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        size += shard.map.memory_size() 
+                + shard.names.capacity() * sizeof(std::string_view)
+                + shard.chars.capacity_bytes();
+    }
+    return size;
+}
@@ -0,0 +1,41 @@
+#ifndef ATOM_HPP
+#define ATOM_HPP
+
+// Atoms are interned identifiers.
+// Every distinct name maps to a single 32-bit handle, so names can be
+// compared and hashed as integers instead of as strings.
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "fnv1a.hpp"
+#include "handle.hpp"
+
+using atom_ht = handle_t<std::uint32_t, struct atom_ht_tag, 0>;
+
+using atom_hash_t = std::uint32_t;
+
+inline atom_hash_t atom_hash(char const* begin, char const* end)
+{
+    return fnv1a<atom_hash_t>::hash(begin, end);
+}
+
+// Returns the atom for 'name', creating it if it doesn't exist yet.
+// 'hash' must equal 'atom_hash(name)'.
+// This function is thread-safe.
+atom_ht intern(std::string_view name, atom_hash_t hash);
+
+inline atom_ht intern(std::string_view name)
+{
+    return intern(name, atom_hash(name.data(), name.data() + name.size()));
+}
+
+// Returns the name an atom was interned from.
+// The view remains valid for the rest of the program.
+std::string_view atom_name(atom_ht atom);
+
+// The bytes held by the atom table.
+std::size_t atom_memory_size();
+
+#endif
@@ -10,8 +10,9 @@
 #include "cg_order.hpp"
 #include "cg_schedule.hpp"
 #include "locator.hpp"
+#include "profile.hpp"
+#include "trace.hpp"
 
-#include <iostream> // TODO
 
 // Nodes will be partitioned into congruence classes for coalescing
 // purposes, dubbed "cset" for brevity.
@@ -343,13 +344,19 @@ void code_gen(ir_t& ir)
     // SCHEDULING //
     ////////////////
 
-    schedule_ir(ir);
+    {
+        profile_scope_t scope("schedule_ir");
+        schedule_ir(ir);
+    }
 
     ///////////////////////////
     // LIVENESS SET CREATION //
     ///////////////////////////
 
-    calc_liveness(ir);
+    {
+        profile_scope_t scope("calc_liveness");
+        calc_liveness(ir);
+    }
     
     // Note: once the live sets have been built, the IR cannot be modified
     // until all liveness checks are done.
@@ -400,7 +407,7 @@ void code_gen(ir_t& ir)
         locator_t const loc = pair.first;
         auto& ld = pair.second;
 
-        std::puts("PAIR");
+        TRACE(coalesce, "PAIR\n");
 
         // Prioritize less busy ranges over larger ones.
         for(copy_t& copy : ld.copies)
@@ -496,7 +503,7 @@ void code_gen(ir_t& ir)
     // Now coalesce 'SSA_phi_copy's with their inputs.
     for(copy_t const& copy : phi_copies)
     {
-        std::puts("CHEKING PHI COPY");
+        TRACE(coalesce, "CHECKING PHI COPY\n");
         assert(copy.node->op() == SSA_phi_copy);
         ssa_ht candidate = copy.node->input(0).handle();
 
@@ -509,7 +516,7 @@ void code_gen(ir_t& ir)
             //if(copy_loc && candidate_loc != copy_loc)
             if(!cset_mergable(copy_cset, candidate_cset))
             {
-                std::puts("not merg");
+                TRACE(coalesce, "not mergable\n");
                 continue;
             }
 
@@ -519,7 +526,7 @@ void code_gen(ir_t& ir)
                                         &*ptr->second.write_points.begin(), 
                                         &*ptr->second.write_points.end()))
                 {
-                    std::puts("not live");
+                    TRACE(coalesce, "not live\n");
                     continue;
                 }
             }
@@ -528,7 +535,7 @@ void code_gen(ir_t& ir)
         if(ssa_ht last = csets_dont_interfere(candidate_cset, copy_cset))
             cset_append(last, copy_cset);
         else
-            std::puts("interfere");
+            TRACE(coalesce, "interfere\n");
     }
 
     // Now update the IR.
@@ -610,12 +617,17 @@ void code_gen(ir_t& ir)
     {
         auto& d = cg_data(cfg_it);
 
-        std::cout << "\n\n";
-
-        for(ssa_ht h : d.schedule)
-            std::cout << "sched " << h->op() << '\n';
+        if(trace_enabled(TRACE_sched))
+        {
+            trace_stream() << "\n\n";
+            for(ssa_ht h : d.schedule)
+                trace_stream() << "sched " << h->op() << '\n';
+        }
 
-        d.code = select_instructions(cfg_it);
+        {
+            profile_scope_t scope("select_instructions");
+            d.code = select_instructions(cfg_it);
+        }
 
         for(ainst_t inst : d.code)
         {
@@ -677,13 +689,20 @@ void code_gen(ir_t& ir)
     // ORDER BASIC BLOCKS //
     ////////////////////////
 
-    std::vector<cfg_ht> order = order_ir(ir);
+    std::vector<cfg_ht> order;
+    {
+        profile_scope_t scope("order_ir");
+        order = order_ir(ir);
+    }
 
-    for(cfg_ht h : order)
+    if(trace_enabled(TRACE_asm))
     {
-        std::cout << "CFG = " << h.index << '\n';
-        for(ainst_t inst : cg_data(h).code)
-            std::cout << inst << '\n';
+        for(cfg_ht h : order)
+        {
+            trace_stream() << "CFG = " << h.index << '\n';
+            for(ainst_t inst : cg_data(h).code)
+                trace_stream() << inst << '\n';
+        }
     }
 
 }
@@ -1,7 +1,6 @@
 #include "cg_isel.hpp"
 
 #include <cstdint>
-#include <iostream> // TODO
 #include <functional>
 #include <vector>
 
@@ -9,6 +8,8 @@
 #include "robin/map.hpp"
 
 #include "array_pool.hpp"
+#include "mem_report.hpp"
+#include "trace.hpp"
 
 
 // An approximation of the CPU's state at a given position.
@@ -1275,7 +1276,7 @@ namespace isel
 
         case SSA_jump:
             assert(cfg_node->output_size() == 1);
-            std::puts("JUMPIN");
+            TRACE(isel, "JUMPIN\n");
 
             // TODO: use conditional jumps for efficiency.
             (def_op<JMP>{{}, locator_t::cfg_label(cfg_node->output(0)) }
@@ -1303,7 +1304,7 @@ namespace isel
 
 
         default:
-            std::cout << "FAIL = " << h->op() << '\n';
+            TRACE(isel, "FAIL = " << h->op() << '\n');
             assert(false);
             break;
         }
@@ -1313,9 +1314,9 @@ namespace isel
     {
         cfg_ht const cfg_node = h->cfg_node();
 
-        std::cout << "doing " << h->op() << '\n';
+        TRACE(isel, "doing " << h->op() << '\n');
         if(cg_data(h).store_in_locs.size())
-            std::puts("has store in locs");
+            TRACE(isel, "has store in locs\n");
 
         switch(h->op())
         {
@@ -1420,6 +1421,8 @@ std::vector<ainst_t> select_instructions(cfg_ht cfg_node)
     for(ssa_ht h : cd.schedule)
         isel_node(h);
 
+    mem_high_water(MEM_sel_pool, state.sel_pool.capacity_bytes());
+
     std::vector<ainst_t> code;
     for(sel_t const* sel = state.best_sel; sel; sel = sel->prev)
         code.push_back(sel->inst);
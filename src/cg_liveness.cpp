@@ -3,6 +3,7 @@
 #include "alloca.hpp"
 #include "cg.hpp"
 #include "ir.hpp"
+#include "mem_report.hpp"
 #include "worklist.hpp"
 
 static inline cfg_liveness_d& live(cfg_ht h) 
@@ -73,6 +74,7 @@ unsigned calc_liveness(ir_t const& ir, unsigned pool_size)
     for(ssa_ht ssa_it = cfg_it->ssa_begin(); ssa_it; ++ssa_it)
         calc_liveness(ssa_it);
 
+    mem_high_water(MEM_liveness_bitset_pool, bitset_pool.capacity_bytes());
     return set_size;
 }
 
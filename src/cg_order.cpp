@@ -1,10 +1,10 @@
 #include "cg_order.hpp"
-#include <iostream> // TODO
 
 #include <random>
 
 #include "cg.hpp"
 #include "ir.hpp"
+#include "trace.hpp"
 
 namespace
 {
@@ -127,11 +127,14 @@ aco_t::aco_t(ir_t& ir) : ir(ir), gen(0xDEADBEEF)
             if(ant.cost < best_ant.cost)
                 best_ant.swap(ant);
 
-            std::cout << '\n';
-            for(cfg_ht h : best_ant.path)
-                std::cout << "REMAINING = " << h.index << '\n';
-
-            std::cout << "COSTS: " << ant.cost << ' ' << best_ant.cost << '\n';
+            if(trace_enabled(TRACE_order))
+            {
+                trace_stream() << '\n';
+                for(cfg_ht h : best_ant.path)
+                    trace_stream() << "REMAINING = " << h.index << '\n';
+                trace_stream() << "COSTS: " << ant.cost << ' '
+                               << best_ant.cost << '\n';
+            }
         }
 
         // Evaporate pheramones:
@@ -1,12 +1,13 @@
 #include "cg_schedule.hpp"
 
-#include <iostream> // TODO
 #include <vector>
 
 #include "alloca.hpp"
 #include "cg.hpp"
 #include "ir.hpp"
 #include "ir_util.hpp"
+#include "mem_report.hpp"
+#include "trace.hpp"
 
 namespace { // anon namespace
 
@@ -76,7 +77,7 @@ scheduler_t::scheduler_t(ir_t& ir, cfg_ht cfg_node)
     if(ssa_ht exit = cfg_node->last_daisy())
     {
         auto& exit_d = data(exit);
-        std::cout << exit->op() << '\n';
+        TRACE(sched, "exit " << exit->op() << '\n');
         assert(exit->output_size() == 0);
         for(ssa_ht ssa_node : toposorted)
             if(ssa_node != exit)
@@ -116,6 +117,8 @@ scheduler_t::scheduler_t(ir_t& ir, cfg_ht cfg_node)
         if(ssa_flags(ssa_node->op()) & SSAF_CLOBBERS_CARRY)
             bitset_set(carry_clobberers, index(ssa_node));
 
+    mem_high_water(MEM_schedule_bitset_pool, bitset_pool.capacity_bytes());
+
 
     // Now add extra deps to aid scheduling efficiency.
     auto propagate_deps_change = [&](ssa_ht changed)
@@ -0,0 +1,317 @@
+#include "compile_cache.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <unistd.h>
+
+#include "fnv1a.hpp"
+#include "format.hpp"
+#include "globals.hpp"
+#include "options.hpp"
+#include "trace.hpp"
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    // Bump this when the key or the entry format changes.
+    constexpr char const* cache_version = "mosbol cache 2";
+
+    // Keys are kept whole, rather than hashed, so that two fns can never
+    // share an entry. Values are written 7 bits per byte, as most are
+    // small, which keeps the keys about as small as the fn's tokens.
+    struct key_builder_t
+    {
+        std::string key;
+
+        void add(std::uint64_t value)
+        {
+            for(; value >= 0x80; value >>= 7)
+                key.push_back(static_cast<char>(value | 0x80));
+            key.push_back(static_cast<char>(value));
+        }
+
+        void add(std::string_view str)
+        {
+            add(str.size());
+            key.append(str);
+        }
+
+        void add(type_t type) { add(to_string(type)); }
+
+        void add_expr(token_t const* token)
+        {
+            if(!token)
+                return add(0);
+
+            // Exprs end with a null token.
+            for(; token->type; ++token)
+            {
+                add(token->type);
+                if(token->type == TOK_global_ident)
+                    add(token->ptr<global_t>()->name);
+                else
+                    add(static_cast<std::uint64_t>(token->value));
+            }
+            add(0);
+        }
+
+        // Sets are hashed by name, as indices can differ between runs.
+        void add(gvar_set_t const& set)
+        {
+            std::vector<std::string_view> names;
+            set.for_each([&names](unsigned var)
+            {
+                names.push_back(global_t::get_var({ var }).name);
+            });
+            std::sort(names.begin(), names.end());
+
+            add(names.size());
+            for(std::string_view name : names)
+                add(name);
+        }
+    };
+
+    // Atoms outlive the globals, so unlike var indices,
+    // they stay valid between compiles of the same process.
+    struct entry_t
+    {
+        bool io_pure;
+        std::vector<atom_ht> reads;
+        std::vector<atom_ht> writes;
+    };
+
+    std::mutex memory_mutex; // Protects the objects below:
+    std::unordered_map<std::string, entry_t> memory;
+
+    void save_in_memory(std::string const& key, entry_t entry)
+    {
+        std::lock_guard<std::mutex> lock(memory_mutex);
+        memory.insert_or_assign(key, std::move(entry));
+    }
+
+    std::vector<atom_ht> to_atoms(gvar_set_t const& set)
+    {
+        std::vector<atom_ht> atoms;
+        set.for_each([&atoms](unsigned var)
+        {
+            atoms.push_back(global_t::get_var({ var }).atom);
+        });
+        return atoms;
+    }
+
+    // Maps var names to var indices.
+    // Returns false if one doesn't name a var anymore.
+    bool to_vars(std::vector<atom_ht> const& atoms, 
+                 std::vector<unsigned>& vars)
+    {
+        for(atom_ht atom : atoms)
+        {
+            global_t const* var = global_t::find(atom);
+            if(!var || var->gclass() != GLOBAL_VAR)
+                return false;
+            vars.push_back(var->var().value);
+        }
+        return true;
+    }
+
+    bool load_entry(entry_t const& entry, fn_t& fn)
+    {
+        std::vector<unsigned> reads;
+        std::vector<unsigned> writes;
+        if(!to_vars(entry.reads, reads) || !to_vars(entry.writes, writes))
+            return false;
+        fn.set_summaries(gvar_set_t::intern(reads), 
+                         gvar_set_t::intern(writes), entry.io_pure);
+        return true;
+    }
+
+    // Files are named by a hash of the key. Each holds its whole key,
+    // so a fn whose key hashes the same doesn't load the wrong entry.
+    fs::path entry_path(std::string const& key)
+    {
+        std::uint64_t const hash = fnv1a<std::uint64_t>::hash(key);
+        return fs::path(compiler_options().cache_dir) / fmt("%.sum", hash);
+    }
+
+    bool read_atoms(std::istream& is, char const* label,
+                    std::vector<atom_ht>& atoms)
+    {
+        std::string word;
+        std::size_t size;
+        if(!(is >> word >> size) || word != label)
+            return false;
+
+        std::string name;
+        for(std::size_t i = 0; i < size; ++i)
+        {
+            if(!(is >> name))
+                return false;
+            atoms.push_back(intern(name));
+        }
+        return true;
+    }
+
+    void write_atoms(std::ostream& os, char const* label,
+                     std::vector<atom_ht> const& atoms)
+    {
+        os << label << ' ' << atoms.size() << '\n';
+        for(atom_ht atom : atoms)
+            os << atom_name(atom) << '\n';
+    }
+} // end anon namespace
+
+bool compile_cache_enabled()
+{
+    return compiler_options().watch || !compiler_options().cache_dir.empty();
+}
+
+std::string compile_cache_key(global_t const& global)
+{
+    key_builder_t key;
+    key.add(cache_version);
+    // Other builds of the compiler can compile differently.
+    key.add(GIT_COMMIT);
+    // The only option that changes what a fn compiles to.
+    key.add(compiler_options().optimize);
+
+    fn_t const& fn = global.fn();
+    key.add(global.type());
+    key.add(fn.def.num_params);
+    key.add(fn.def.local_vars.size());
+    for(var_decl_t const& var : fn.def.local_vars)
+        key.add(var.type);
+
+    key.add(fn.def.stmts.size());
+    for(stmt_t const& stmt : fn.def.stmts)
+    {
+        key.add(static_cast<std::uint64_t>(stmt.name));
+        if(stmt.name == STMT_LABEL || stmt.name == STMT_GOTO)
+            key.add(stmt.label->stmt_h.value);
+        else
+            key.add_expr(stmt.expr);
+    }
+
+    // The order of 'ideps' depends on addresses, so sort them by name.
+    std::vector<global_t const*> ideps(global.ideps().begin(),
+                                       global.ideps().end());
+    std::sort(ideps.begin(), ideps.end(),
+              [](global_t const* a, global_t const* b) -> bool
+              {
+                  return a->name < b->name;
+              });
+
+    key.add(ideps.size());
+    for(global_t const* idep : ideps)
+    {
+        key.add(idep->name);
+        key.add(idep->gclass());
+        key.add(idep->type());
+        if(idep->gclass() == GLOBAL_FN)
+        {
+            key.add(idep->fn().reads());
+            key.add(idep->fn().writes());
+            key.add(idep->fn().io_pure());
+        }
+    }
+
+    return std::move(key.key);
+}
+
+bool compile_cache_load(std::string const& key, fn_t& fn)
+{
+    // Graphviz files and traces are written while compiling,
+    // so fns loaded from the cache would be missing from them.
+    if(compiler_options().graphviz || trace_mask)
+        return false;
+
+    {
+        std::lock_guard<std::mutex> lock(memory_mutex);
+        auto it = memory.find(key);
+        if(it != memory.end())
+            return load_entry(it->second, fn);
+    }
+
+    if(compiler_options().cache_dir.empty())
+        return false;
+
+    std::ifstream is(entry_path(key));
+    if(!is.is_open())
+        return false;
+
+    std::string version;
+    if(!std::getline(is, version) || version != cache_version)
+        return false;
+
+    std::string word;
+    std::size_t key_size;
+    if(!(is >> word >> key_size) || word != "key" || is.get() != '\n'
+       || key_size != key.size())
+    {
+        return false;
+    }
+
+    std::string file_key(key_size, '\0');
+    if(!is.read(file_key.data(), key_size) || file_key != key)
+        return false;
+
+    entry_t entry;
+    if(!(is >> word >> entry.io_pure) || word != "io_pure")
+        return false;
+
+    if(!read_atoms(is, "reads", entry.reads) 
+       || !read_atoms(is, "writes", entry.writes))
+    {
+        return false;
+    }
+
+    if(!load_entry(entry, fn))
+        return false;
+    save_in_memory(key, std::move(entry));
+    return true;
+}
+
+void compile_cache_store(std::string const& key, fn_t const& fn)
+{
+    entry_t entry = { fn.io_pure(), to_atoms(fn.reads()), 
+                      to_atoms(fn.writes()) };
+
+    if(!compiler_options().cache_dir.empty())
+    {
+        std::error_code ec;
+        fs::create_directories(compiler_options().cache_dir, ec);
+
+        // Write to a temporary file first, so that other compiles
+        // never see a partial entry.
+        fs::path const path = entry_path(key);
+        fs::path tmp_path = path;
+        tmp_path += fmt(".%.%.tmp", getpid(), 
+            std::hash<std::thread::id>()(std::this_thread::get_id()));
+
+        bool written;
+        {
+            std::ofstream os(tmp_path);
+            os << cache_version << '\n';
+            os << "key " << key.size() << '\n' << key << '\n';
+            os << "io_pure " << entry.io_pure << '\n';
+            write_atoms(os, "reads", entry.reads);
+            write_atoms(os, "writes", entry.writes);
+            written = os.is_open() && os.good();
+        }
+
+        if(written)
+            fs::rename(tmp_path, path, ec);
+        if(!written || ec)
+            fs::remove(tmp_path, ec);
+    }
+
+    save_in_memory(key, std::move(entry));
+}
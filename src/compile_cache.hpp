@@ -0,0 +1,37 @@
+#ifndef COMPILE_CACHE_HPP
+#define COMPILE_CACHE_HPP
+
+// A cache of compiled fns, enabled by '--cache-dir' or '--watch'.
+// Entries are kept in memory for the life of the process, and saved
+// on disk when there's a cache directory.
+//
+// Entries are keyed by everything a fn's compile depends on: its
+// statements and tokens, its type and locals, the names, types and
+// summaries of its ideps, the compiler's commit and the optimize option.
+// Positions in the source aren't part of the key, so editing one fn
+// doesn't invalidate the others.
+// Entries are never loaded when writing graphviz files or traces,
+// as those are written by the compile itself.
+//
+// Entries hold the fn's summaries, naming vars rather than indexing them,
+// as var indices depend on the order files get parsed in.
+
+#include <string>
+
+struct global_t;
+class fn_t;
+
+bool compile_cache_enabled();
+
+// Returns the cache key for compiling 'global', which must be a fn
+// whose ideps are compiled. It's never empty.
+std::string compile_cache_key(global_t const& global);
+
+// Sets the summaries of 'fn' from the cache.
+// Returns false if there's no entry for 'key'.
+bool compile_cache_load(std::string const& key, fn_t& fn);
+
+// Saves the summaries of 'fn', which just compiled.
+void compile_cache_store(std::string const& key, fn_t const& fn);
+
+#endif
@@ -410,7 +410,6 @@ ABSTRACT(SSA_phi) = ABSTRACT_FN
         result[i] = constraints_t::top();
         for(unsigned j = 0; j < argn; ++j)
         {
-            std::printf("j = %i\n", j);
             assert(cv[j].vec.size());
             assert(cv[j].vec.size() >= result.vec.size());
             result[i] = union_(result[i], cv[j][i]);
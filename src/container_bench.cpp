@@ -0,0 +1,368 @@
+// Measures the in-tree containers against their std equivalents,
+// at the sizes the compiler uses them at.
+// Covers the hash tables, the flat containers, the pools and the
+// bitset kernels. Numbers are nanoseconds per element or per word.
+//
+// Usage: container_bench [scale]
+// 'scale' multiplies the work done per measurement (default 1).
+
+#include <bitset>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "array_pool.hpp"
+#include "bitset.hpp"
+#include "flat/small_map.hpp"
+#include "flat/small_set.hpp"
+#include "robin/map.hpp"
+#include "robin/set.hpp"
+#include "static_pool.hpp"
+
+namespace
+{
+    using clock = std::chrono::steady_clock;
+
+    // Deterministic, so that runs are comparable.
+    struct rng_t
+    {
+        std::uint64_t state = 0x853c49e6748fea9bull;
+
+        std::uint32_t operator()()
+        {
+            state = state * 6364136223846793005ull + 1442695040888963407ull;
+            return state >> 32;
+        }
+    };
+
+    // Results are summed into this, so the work can't be optimized away.
+    std::uint64_t volatile sink;
+
+    unsigned scale = 1;
+
+    // Each measurement processes about this many elements.
+    std::size_t work() { return 1u << 19; }
+
+    double ns_per(clock::duration d, std::size_t count)
+    {
+        return std::chrono::duration<double, std::nano>(d).count() / count;
+    }
+
+    // Container sizes, from a fn's few locals to a program's globals.
+    constexpr std::size_t sizes[] = { 8, 64, 1024, 16384 };
+
+    std::vector<std::uint32_t> gen_keys(std::size_t size)
+    {
+        rng_t rng;
+        std::vector<std::uint32_t> keys(size);
+        for(std::uint32_t& key : keys)
+            key = rng();
+        return keys;
+    }
+
+    template<typename V>
+    std::uint32_t key_of(V const& v)
+    {
+        if constexpr(requires { v.first; })
+            return v.first;
+        else
+            return v;
+    }
+
+    template<typename C>
+    void insert(C& c, std::uint32_t key)
+    {
+        if constexpr(requires { c[key] = key; })
+            c[key] = key;
+        else
+            c.insert(key);
+    }
+
+    template<typename C>
+    void erase(C& c, std::uint32_t key)
+    {
+        // The rh tables erase by key with 'remove'.
+        if constexpr(requires { c.remove(key); })
+            c.remove(key);
+        else
+            c.erase(key);
+    }
+
+    struct op_times_t
+    {
+        clock::duration insert = {};
+        clock::duration find = {};
+        clock::duration iterate = {};
+        clock::duration erase = {};
+        clock::duration clear = {};
+        std::size_t count = 0;
+    };
+
+    template<typename C>
+    void run_container(char const* name, bool iterable)
+    {
+        for(std::size_t size : sizes)
+        {
+            std::vector<std::uint32_t> const keys = gen_keys(size);
+            std::size_t const reps = std::max<std::size_t>(
+                1, work() * scale / size);
+            op_times_t t;
+            std::uint64_t sum = 0;
+
+            for(std::size_t rep = 0; rep < reps; ++rep)
+            {
+                C c;
+
+                auto time = clock::now();
+                for(std::uint32_t key : keys)
+                    insert(c, key);
+                t.insert += clock::now() - time;
+
+                time = clock::now();
+                for(std::uint32_t key : keys)
+                    sum += c.count(key);
+                t.find += clock::now() - time;
+
+                if constexpr(requires { c.begin(); })
+                {
+                    time = clock::now();
+                    for(auto const& v : c)
+                        sum += key_of(v);
+                    t.iterate += clock::now() - time;
+                }
+
+                time = clock::now();
+                for(std::uint32_t key : keys)
+                    erase(c, key);
+                t.erase += clock::now() - time;
+
+                for(std::uint32_t key : keys)
+                    insert(c, key);
+                time = clock::now();
+                c.clear();
+                t.clear += clock::now() - time;
+
+                t.count += size;
+            }
+
+            sink = sink + sum;
+            if(iterable)
+                std::printf("%-22s %7zu %9.2f %9.2f %9.2f %9.2f %9.2f\n",
+                            name, size, ns_per(t.insert, t.count),
+                            ns_per(t.find, t.count),
+                            ns_per(t.iterate, t.count),
+                            ns_per(t.erase, t.count),
+                            ns_per(t.clear, t.count));
+            else
+                std::printf("%-22s %7zu %9.2f %9.2f %9s %9.2f %9.2f\n",
+                            name, size, ns_per(t.insert, t.count),
+                            ns_per(t.find, t.count), "-",
+                            ns_per(t.erase, t.count),
+                            ns_per(t.clear, t.count));
+        }
+    }
+
+    template<typename C>
+    void run_container(char const* name)
+    {
+        run_container<C>(name, requires(C c) { c.begin(); });
+    }
+
+    // Sized like the IR's nodes.
+    struct node_data_t
+    {
+        std::uint64_t data[4];
+    };
+
+    struct bench_node_t;
+    using bench_pool = static_intrusive_pool_t<bench_node_t>;
+
+    struct bench_node_t : public intrusive_t<bench_pool::handle_t>
+    {
+        node_data_t data;
+    };
+
+    // Allocates 'size' nodes, then frees them all.
+    template<typename Alloc, typename Free>
+    void run_pool(char const* name, Alloc alloc, Free free)
+    {
+        for(std::size_t size : sizes)
+        {
+            std::size_t const reps = std::max<std::size_t>(
+                1, work() * scale / size);
+            clock::duration alloc_time = {};
+            clock::duration free_time = {};
+
+            for(std::size_t rep = 0; rep < reps; ++rep)
+            {
+                auto time = clock::now();
+                auto nodes = alloc(size);
+                alloc_time += clock::now() - time;
+
+                time = clock::now();
+                free(nodes);
+                free_time += clock::now() - time;
+            }
+
+            std::printf("%-22s %7zu %9.2f %9.2f\n", name, size,
+                        ns_per(alloc_time, reps * size),
+                        ns_per(free_time, reps * size));
+        }
+    }
+
+    void run_pools()
+    {
+        std::printf("\nPools (ns per node)\n");
+        std::printf("%-22s %7s %9s %9s\n", "pool", "size", "alloc", "free");
+
+        array_pool_t<node_data_t> array_pool;
+        run_pool("array_pool_t",
+            [&](std::size_t size)
+            {
+                for(std::size_t i = 0; i < size; ++i)
+                    array_pool.alloc()->data[0] = i;
+                return 0;
+            },
+            [&](int) { array_pool.clear(); });
+
+        run_pool("static_intrusive_pool_t",
+            [](std::size_t size)
+            {
+                std::vector<bench_pool::handle_t> handles(size);
+                for(std::size_t i = 0; i < size; ++i)
+                {
+                    handles[i] = bench_pool::alloc();
+                    handles[i]->data.data[0] = i;
+                }
+                return handles;
+            },
+            [](std::vector<bench_pool::handle_t> const& handles)
+            {
+                for(bench_pool::handle_t h : handles)
+                    bench_pool::free(h);
+            });
+        bench_pool::clear();
+
+        run_pool("new/delete",
+            [](std::size_t size)
+            {
+                std::vector<std::unique_ptr<node_data_t>> nodes(size);
+                for(std::size_t i = 0; i < size; ++i)
+                {
+                    nodes[i] = std::make_unique<node_data_t>();
+                    nodes[i]->data[0] = i;
+                }
+                return nodes;
+            },
+            [](std::vector<std::unique_ptr<node_data_t>>& nodes)
+            {
+                nodes.clear();
+            });
+    }
+
+    // Times 'fn' over enough reps to process 'work()' words.
+    template<typename Fn>
+    double time_words(std::size_t words, Fn fn)
+    {
+        std::size_t const reps = work() * scale * 4 / words;
+        auto const time = clock::now();
+        for(std::size_t rep = 0; rep < reps; ++rep)
+        {
+            fn();
+            // Stops the compiler from hoisting the kernel out of the loop.
+            asm volatile("" ::: "memory");
+        }
+        return ns_per(clock::now() - time, reps * words);
+    }
+
+    template<std::size_t Words>
+    void run_bitset()
+    {
+        constexpr std::size_t bits = Words * sizeof_bits<bitset_uint_t>;
+        rng_t rng;
+
+        bitset_uint_t a[Words];
+        bitset_uint_t b[Words];
+        std::bitset<bits> std_a;
+        std::bitset<bits> std_b;
+        for(std::size_t i = 0; i < Words; ++i)
+        {
+            a[i] = (std::uint64_t(rng()) << 32) | rng();
+            b[i] = (std::uint64_t(rng()) << 32) | rng();
+            for(std::size_t j = 0; j < sizeof_bits<bitset_uint_t>; ++j)
+            {
+                std_a[i * 64 + j] = (a[i] >> j) & 1;
+                std_b[i * 64 + j] = (b[i] >> j) & 1;
+            }
+        }
+
+        std::size_t count = 0;
+        double const or_ns = time_words(Words,
+            [&]{ bitset_or(Words, a, b); });
+        double const and_ns = time_words(Words,
+            [&]{ bitset_and(Words, a, b); });
+        double const popcount_ns = time_words(Words,
+            [&]{ count += bitset_popcount(Words, a); });
+        std::printf("%-22s %7zu %9.3f %9.3f %9.3f\n", "bitset.hpp", bits,
+                    or_ns, and_ns, popcount_ns);
+
+        double const std_or_ns = time_words(Words,
+            [&]{ std_a |= std_b; });
+        double const std_and_ns = time_words(Words,
+            [&]{ std_a &= std_b; });
+        double const std_popcount_ns = time_words(Words,
+            [&]{ count += std_a.count(); });
+        std::printf("%-22s %7zu %9.3f %9.3f %9.3f\n", "std::bitset", bits,
+                    std_or_ns, std_and_ns, std_popcount_ns);
+
+        sink = sink + count + a[0] + std_a.count();
+    }
+
+    void run_bitsets()
+    {
+        std::printf("\nBitsets (ns per 64-bit word)\n");
+        std::printf("%-22s %7s %9s %9s %9s\n",
+                    "bitset", "bits", "or", "and", "popcount");
+        run_bitset<1>();
+        run_bitset<4>();
+        run_bitset<16>();
+        run_bitset<64>();
+        run_bitset<256>();
+    }
+} // end anon namespace
+
+int main(int argc, char** argv)
+{
+    if(argc > 1)
+        scale = std::max(1, std::atoi(argv[1]));
+
+    std::printf("Containers (ns per element)\n");
+    std::printf("%-22s %7s %9s %9s %9s %9s %9s\n",
+                "container", "size", "insert", "find", "iterate",
+                "erase", "clear");
+
+    using key_t = std::uint32_t;
+    run_container<rh::robin_map<key_t, key_t>>("rh::robin_map");
+    run_container<rh::batman_map<key_t, key_t>>("rh::batman_map");
+    run_container<std::unordered_map<key_t, key_t>>("std::unordered_map");
+    run_container<rh::robin_set<key_t>>("rh::robin_set");
+    run_container<rh::batman_set<key_t>>("rh::batman_set");
+    run_container<std::unordered_set<key_t>>("std::unordered_set");
+    run_container<fc::vector_map<key_t, key_t>>("fc::vector_map");
+    run_container<fc::small_map<key_t, key_t, 16, std::less<key_t>>>(
+        "fc::small_map<16>");
+    run_container<std::map<key_t, key_t>>("std::map");
+    run_container<fc::vector_set<key_t>>("fc::vector_set");
+    run_container<fc::small_set<key_t, 16>>("fc::small_set<16>");
+    run_container<std::set<key_t>>("std::set");
+
+    run_pools();
+    run_bitsets();
+}
@@ -1,24 +1,183 @@
 #include "file.hpp"
 
+#include <cassert>
+#include <cerrno>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+
 #include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <fcntl.h>
 #include <unistd.h>
 
+#include "options.hpp"
+
 std::vector<std::string> source_file_names;
 
-file_contents_t::file_contents_t(unsigned file_i)
-: m_file_i(file_i)
+namespace
 {
-    std::string const& name = source_file_names[file_i];
-    int fd = open(name.c_str(), O_RDONLY);
+    // The backing storage of a loaded file.
+    // These live until 'unload_files', so that 'file_contents_t' can be
+    // recreated cheaply when an error message needs the source.
+    struct file_buffer_t
+    {
+        std::once_flag loaded;
+        char const* source = nullptr;
+        std::size_t size = 0;
+
+        // When the file is mmap'd, this holds the size of the mapping.
+        // Otherwise the file was read into 'buffer'.
+        std::size_t mapped_size = 0;
+        std::unique_ptr<char[]> buffer;
+
+        ~file_buffer_t()
+        {
+            if(mapped_size)
+                munmap(const_cast<char*>(source), mapped_size);
+        }
+
+        void load(std::string const& name);
+    private:
+        bool try_mmap(int fd, std::size_t file_size);
+        void read_all(int fd, std::string const& name);
+    };
+
+    struct file_table_t
+    {
+        std::once_flag allocated;
+        std::unique_ptr<file_buffer_t[]> buffers;
+    };
+
+    std::unique_ptr<file_table_t> files(new file_table_t());
+
+    struct fd_guard_t
+    {
+        int fd;
+        ~fd_guard_t() { if(fd >= 0) close(fd); }
+    };
+} // end anon namespace
+
+void file_buffer_t::load(std::string const& name)
+{
+    fd_guard_t fd = { open(name.c_str(), O_RDONLY) };
+    if(fd.fd == -1)
+        throw std::runtime_error("Unable to open file: " + name);
+
     struct stat sb;
-    if(fstat(fd, &sb) == -1)
+    if(fstat(fd.fd, &sb) == -1)
         throw std::runtime_error("Unable to stat file: " + name);
-    m_source.reset(new char[sb.st_size + 1]);
-    if(read(fd, reinterpret_cast<void*>(m_source.get()), sb.st_size) == -1)
-        throw std::runtime_error("Unable to read file: " + name);
-    m_source[sb.st_size] = '\0';
+
+    // Special files (pipes and such) report a size of 0 and can't be mapped.
+    if(compiler_options().mmap_files && S_ISREG(sb.st_mode) && sb.st_size > 0
+       && try_mmap(fd.fd, sb.st_size))
+    {
+        return;
+    }
+
+    read_all(fd.fd, name);
 }
 
+// Maps the file, followed by at least one '\0'.
+// Returns false if the file couldn't be mapped.
+bool file_buffer_t::try_mmap(int fd, std::size_t file_size)
+{
+    std::size_t const page_size = sysconf(_SC_PAGESIZE);
+
+    if(file_size % page_size)
+    {
+        // The kernel zero-fills the remainder of the last page,
+        // which provides the '\0' terminator for free.
+        void* ptr = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if(ptr == MAP_FAILED)
+            return false;
+        mapped_size = file_size;
+        source = static_cast<char const*>(ptr);
+    }
+    else
+    {
+        // The file ends on a page boundary, so there's no slack to hold
+        // the terminator. Reserve one extra zero page after the file,
+        // then map the file over the front of the reservation.
+        std::size_t const reserve_size = file_size + page_size;
+        void* reserved = mmap(nullptr, reserve_size, PROT_READ, 
+                              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if(reserved == MAP_FAILED)
+            return false;
+        void* ptr = mmap(reserved, file_size, PROT_READ, 
+                         MAP_PRIVATE | MAP_FIXED, fd, 0);
+        if(ptr == MAP_FAILED)
+        {
+            munmap(reserved, reserve_size);
+            return false;
+        }
+        mapped_size = reserve_size;
+        source = static_cast<char const*>(ptr);
+    }
+
+    // The parser reads files front to back, exactly once.
+    madvise(const_cast<char*>(source), mapped_size, MADV_SEQUENTIAL);
+
+    size = file_size;
+    assert(source[size] == '\0');
+    return true;
+}
+
+// Reads the file into 'buffer', handling short reads and files 
+// of unknown size.
+void file_buffer_t::read_all(int fd, std::string const& name)
+{
+    std::size_t capacity = 4096;
+    std::size_t used = 0;
+    buffer.reset(new char[capacity + 1]);
+
+    while(true)
+    {
+        if(used == capacity)
+        {
+            capacity *= 2;
+            std::unique_ptr<char[]> new_buffer(new char[capacity + 1]);
+            std::memcpy(new_buffer.get(), buffer.get(), used);
+            buffer = std::move(new_buffer);
+        }
+
+        ssize_t const amount = read(fd, buffer.get() + used, capacity - used);
+        if(amount == 0)
+            break;
+        if(amount == -1)
+        {
+            if(errno == EINTR)
+                continue;
+            throw std::runtime_error("Unable to read file: " + name);
+        }
+        used += amount;
+    }
+
+    buffer[used] = '\0';
+    source = buffer.get();
+    size = used;
+}
+
+file_contents_t::file_contents_t(unsigned file_i)
+: m_file_i(file_i)
+{
+    assert(file_i < source_file_names.size());
+
+    std::call_once(files->allocated, []
+    {
+        files->buffers.reset(new file_buffer_t[source_file_names.size()]);
+    });
+
+    file_buffer_t& file = files->buffers[file_i];
+    std::call_once(file.loaded, [&]{ file.load(source_file_names[file_i]); });
+
+    m_source = file.source;
+    m_size = file.size;
+}
+
+void unload_files()
+{
+    files.reset(new file_table_t());
+}
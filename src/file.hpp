@@ -1,28 +1,36 @@
 #ifndef FILE_HPP
 #define FILE_HPP
 
-#include <memory>
+#include <cstddef>
 #include <string>
 #include <vector>
 
 extern std::vector<std::string> source_file_names;
 
 // Holds the contents of a file in a buffer and its filename.
+// Files are loaded on first use and stay resident for the rest of the 
+// compile (mmap'd when possible), so constructing these is cheap.
+// The buffer is always terminated by a '\0', which the lexer relies on.
 struct file_contents_t
 {
 public:
     file_contents_t() = delete;
-    // Reads the file from disk.
+    // Loads the file from disk, unless it was already loaded.
     explicit file_contents_t(unsigned file_i);
-    file_contents_t(file_contents_t&&) = default;
-    file_contents_t& operator=(file_contents_t&&) = default;
 
     std::string const& name() const { return source_file_names[m_file_i]; }
     unsigned index() const { return m_file_i; }
-    char const* source() const { return m_source.get(); }
+    char const* source() const { return m_source; }
+    // Doesn't include the '\0' terminator.
+    std::size_t size() const { return m_size; }
 private:
     unsigned m_file_i;
-    std::unique_ptr<char[]> m_source;
+    char const* m_source;
+    std::size_t m_size;
 };
 
+// Forgets every loaded file, so that changes get loaded on next use.
+// This function isn't thread-safe.
+void unload_files();
+
 #endif
@@ -2,54 +2,117 @@
 
 #include <iostream>
 #include <fstream>
+#include <numeric>
+
+#include "robin/hash.hpp"
+#include "flat/flat_map.hpp"
 
-#include "alloca.hpp"
 #include "bitset.hpp"
 #include "compiler_error.hpp"
-#include "fnv1a.hpp"
 #include "ir_builder.hpp"
 #include "o.hpp"
 #include "options.hpp"
 #include "byteify.hpp"
 #include "cg.hpp"
+#include "compile_cache.hpp"
 #include "graphviz.hpp"
+#include "mem_report.hpp"
+#include "profile.hpp"
 #include "thread.hpp"
+#include "trace.hpp"
 
 // global_t statics:
-std::deque<global_t> global_t::global_pool;
+sharded_pool_t<global_t> global_t::global_pool;
 std::deque<fn_t> global_t::fn_pool;
-std::vector<global_t*> global_t::var_vec;
-std::vector<global_t*> global_t::ready;
+std::deque<global_t::arena_t> global_t::arena_pool;
+std::vector<global_t::arena_t*> global_t::free_arenas;
+std::vector<global_t*> global_t::speculation_candidates;
+std::deque<scc_t> global_t::scc_pool;
+std::vector<global_t*> global_t::entry_points;
+
+global_t::arena_t& global_t::local_arena()
+{
+    assert(parse_arena);
+    return *parse_arena;
+}
+
+global_t::arena_t* global_t::acquire_arena()
+{
+    arena_t* arena;
+    {
+        std::lock_guard<std::mutex> lock(arena_pool_mutex);
+        if(free_arenas.empty())
+            arena = &arena_pool.emplace_back();
+        else
+        {
+            arena = free_arenas.back();
+            free_arenas.pop_back();
+        }
+    }
+    arena->refs = 1;
+    return arena;
+}
+
+void global_t::release_arena(arena_t* arena)
+{
+    if(--arena->refs != 0)
+        return;
+
+    mem_high_water(MEM_expr_pool, arena->expr_pool.capacity_bytes());
+    mem_high_water(MEM_label_pool, arena->label_pool.capacity_bytes());
+
+    // Labels own memory, but the pool only destroys them when
+    // its buffers are freed.
+    arena->label_pool.clear();
+    arena->label_pool.shrink_to_fit();
+    // Tokens don't, so their buffers get reused by the next chunk.
+    arena->expr_pool.clear();
+
+    std::lock_guard<std::mutex> lock(arena_pool_mutex);
+    free_arenas.push_back(arena);
+}
+
+global_t::parse_arena_t::parse_arena_t()
+{
+    assert(!parse_arena);
+    parse_arena = acquire_arena();
+}
+
+global_t::parse_arena_t::~parse_arena_t()
+{
+    release_arena(&local_arena());
+    parse_arena = nullptr;
+}
 
 label_t* global_t::new_label()
 {
-    std::lock_guard<std::mutex> lock(label_pool_mutex);
-    return &label_pool.emplace();
+    return &local_arena().label_pool.emplace();
 }
 
 token_t const* global_t::new_expr(token_t const* begin, token_t const* end)
 {
-    std::lock_guard<std::mutex> lock(expr_pool_mutex);
-    return expr_pool.insert(begin, end);
+    return local_arena().expr_pool.insert(begin, end);
 }
 
-global_t& global_t::lookup(pstring_t name, char const* source)
+global_t& global_t::lookup(atom_ht name, pstring_t pstring)
 {
-    std::string_view view = name.view(source);
-    auto hash = fnv1a<std::uint64_t>::hash(view.data(), view.size());
+    auto hash = rh::hash_finalize(name.value);
 
-    std::lock_guard<std::mutex> lock(global_pool_mutex);
-    rh::apair<global_t**, bool> result = global_pool_map.emplace(hash,
-        [view](global_t* ptr) -> bool
+    return global_pool.emplace(hash,
+        [name](global_t const& global) -> bool
         {
-            return std::equal(view.begin(), view.end(), ptr->name.begin());
+            return global.atom == name;
         },
-        [name, source]() -> global_t*
-        { 
-            return &global_pool.emplace_back(name, source);
-        });
+        name, pstring);
+}
 
-    return **result.first;
+global_t* global_t::find(atom_ht name)
+{
+    return global_pool.find(rh::hash_finalize(name.value),
+        [name](global_t const& global) -> bool
+        {
+            return global.atom == name;
+        });
 }
 
 // Changes a global from UNDEFINED to some specified 'gclass'.
@@ -58,9 +121,17 @@ void global_t::define(pstring_t pstring, global_class_t gclass, type_t type,
                       impl_t impl, global_t::ideps_set_t&& ideps)
 {
     assert(compiler_phase() == PHASE_PARSE);
+    bool live;
     {
         std::lock_guard<std::mutex> global_lock(m_define_mutex);
-        if(m_gclass != GLOBAL_UNDEFINED)
+        if(m_gclass != GLOBAL_UNDEFINED && m_imported)
+        {
+            file_contents_t file(pstring.file_i);
+            compiler_error(file, pstring, 
+                fmt("Global identifier % is already defined by a module.",
+                    pstring.view(file.source())));
+        }
+        else if(m_gclass != GLOBAL_UNDEFINED)
         {
             file_contents_t file1(pstring.file_i);
             file_contents_t file2(m_pstring.file_i);
@@ -74,10 +145,31 @@ void global_t::define(pstring_t pstring, global_class_t gclass, type_t type,
         m_type = type;
         m_gclass = gclass;
         m_pstring = pstring;
+        m_redefining = false;
         m_impl = impl;
         m_ideps = std::move(ideps);
+        live = m_live;
     }
     ideps.clear();
+
+    // Whatever a live global uses is live too.
+    if(live)
+        for(global_t* idep : m_ideps)
+            idep->mark_live();
+
+    // Register as a user of each idep, and wait on those not yet compiled.
+    // 'm_ideps_left' is incremented under the idep's lock, so the idep
+    // can't release us before we count it.
+    for(global_t* idep : m_ideps)
+    {
+        std::lock_guard<std::mutex> idep_lock(idep->m_define_mutex);
+        idep->m_iuses.insert(this);
+        if(!idep->m_compiled)
+            ++m_ideps_left;
+    }
+
+    // 'm_ideps_left' started at 1, standing in for the definition.
+    release(nullptr);
 }
 
 fn_t& global_t::define_fn(pstring_t pstring, type_t type,
@@ -88,6 +180,9 @@ fn_t& global_t::define_fn(pstring_t pstring, type_t type,
         std::lock_guard<std::mutex> fns_lock(fn_pool_mutex);
         new_fn = &fn_pool.emplace_back(std::move(fn_def));
     }
+    // The fn's expressions and labels came from this thread's arena.
+    m_arena = &local_arena();
+    ++m_arena->refs;
     define(pstring, GLOBAL_FN, type, { .fn = new_fn }, std::move(ideps));
     return *new_fn;
 }
@@ -97,41 +192,350 @@ gvar_ht global_t::define_var(pstring_t pstring, type_t type,
 {
     unsigned index;
     {
-        std::lock_guard<std::mutex> fns_lock(var_vec_mutex);
-        index = var_vec.size();
-        var_vec.push_back(this);
+        std::lock_guard<std::mutex> vars_lock(var_vec_mutex);
+        index = var_count.load(std::memory_order_relaxed);
+        auto& block = var_blocks.at(index >> var_block_bits);
+        if(!block)
+            block.reset(new global_t*[var_block_size]);
+        block[index & (var_block_size - 1)] = this;
+        var_count.store(index + 1, std::memory_order_release);
     }
     define(pstring, GLOBAL_VAR, type, { .index = index }, std::move(ideps));
     return { index };
 }
 
+fn_t& global_t::import_fn(type_t type, gvar_set_t const& reads, 
+                          gvar_set_t const& writes, bool io_pure)
+{
+    fn_t* new_fn;
+    {
+        std::lock_guard<std::mutex> fns_lock(fn_pool_mutex);
+        new_fn = &fn_pool.emplace_back(fn_def_t());
+    }
+    new_fn->set_summaries(reads, writes, io_pure);
+    m_imported = true;
+    define({}, GLOBAL_FN, type, { .fn = new_fn }, {});
+    return *new_fn;
+}
+
+gvar_ht global_t::import_var(type_t type)
+{
+    m_imported = true;
+    return define_var({}, type, {});
+}
+
+void global_t::add_entry_point(std::string_view name)
+{
+    assert(compiler_phase() == PHASE_PARSE);
+    global_t& global = lookup(intern(name), {});
+    entry_points.push_back(&global);
+    global.mark_live();
+}
+
+void global_t::mark_live()
+{
+    // Globals can be used before they're defined, in which case
+    // 'define' marks their ideps once they are.
+    std::vector<global_t*> worklist = { this };
+    while(!worklist.empty())
+    {
+        global_t* global = worklist.back();
+        worklist.pop_back();
+        {
+            std::lock_guard<std::mutex> lock(global->m_define_mutex);
+            if(global->m_live)
+                continue;
+            global->m_live = true;
+            if(global->m_gclass != GLOBAL_UNDEFINED)
+                worklist.insert(worklist.end(), 
+                                global->m_ideps.begin(), 
+                                global->m_ideps.end());
+        }
+        global->release(nullptr);
+    }
+}
+
 // This function isn't thread-safe.
 // Call from a single thread only.
 void global_t::build_order()
 {
     assert(compiler_phase() == PHASE_ORDER_GLOBALS);
 
-    for(global_t& global : global_pool)
+    for(global_t* global : entry_points)
+        if(global->gclass() == GLOBAL_UNDEFINED)
+            throw compiler_error_t(
+                fmt("Entry point % is not defined.", global->name));
+
+    std::vector<global_t*> globals;
+    unsigned num_live = 0;
+    global_pool.for_each([&globals, &num_live](global_t& global)
     {
+        // Globals removed between watch builds only matter if still used.
+        // Their position is from their old definition, so report a user's.
+        if(global.m_redefining)
+        {
+            if(global.m_iuses.empty())
+                return;
+            global_t const& user = **global.m_iuses.begin();
+            file_contents_t file(user.m_pstring.file_i);
+            compiler_error(file, user.m_pstring, 
+                fmt("% uses %, which isn't defined.", user.name, global.name));
+        }
+
         // Check to make sure every global was defined:
         if(global.gclass() == GLOBAL_UNDEFINED)
         {
             file_contents_t file(global.m_pstring.file_i);
             compiler_error(file, global.m_pstring, "Name not in scope.");
         }
+        globals.push_back(&global);
+        // Resident globals are already compiled.
+        num_live += global.m_live && !global.m_resident;
+    });
+
+    // Find the strongly connected components using Tarjan's algorithm.
+    // Dependency chains can be long, so the DFS uses an explicit stack.
+    // SCCs are found in topological order, dependencies first.
+    std::vector<std::vector<global_t*>> sccs;
+    {
+        unsigned next_index = 0;
+        std::vector<global_t*> scc_stack;
+        std::vector<std::pair<global_t*, unsigned>> dfs_stack;
+
+        auto const visit = [&](global_t* global)
+        {
+            global->m_dfs_index = global->m_dfs_lowlink = ++next_index;
+            global->m_on_dfs_stack = true;
+            scc_stack.push_back(global);
+            dfs_stack.push_back({ global, 0 });
+        };
+
+        for(global_t* root : globals)
+        {
+            if(root->m_dfs_index)
+                continue;
+
+            visit(root);
+            while(!dfs_stack.empty())
+            {
+                auto& [global, idep_i] = dfs_stack.back();
+                if(idep_i < global->m_ideps.size())
+                {
+                    global_t* idep = global->m_ideps.begin()[idep_i++];
+                    if(!idep->m_dfs_index)
+                        visit(idep);
+                    else if(idep->m_on_dfs_stack)
+                        global->m_dfs_lowlink = std::min(global->m_dfs_lowlink,
+                                                         idep->m_dfs_index);
+                    continue;
+                }
+
+                global_t* const done = global;
+                dfs_stack.pop_back();
+                if(!dfs_stack.empty())
+                {
+                    global_t* const parent = dfs_stack.back().first;
+                    parent->m_dfs_lowlink = std::min(parent->m_dfs_lowlink,
+                                                     done->m_dfs_lowlink);
+                }
+
+                if(done->m_dfs_lowlink != done->m_dfs_index)
+                    continue;
+
+                std::vector<global_t*>& scc = sccs.emplace_back();
+                global_t* member;
+                do
+                {
+                    member = scc_stack.back();
+                    scc_stack.pop_back();
+                    member->m_on_dfs_stack = false;
+                    scc.push_back(member);
+                }
+                while(member != done);
+            }
+        }
+    }
+
+    // Propagate costs backwards, from users to their dependencies.
+    // Members of an SCC compile as one, so they share a cost.
+    for(auto it = sccs.rbegin(); it != sccs.rend(); ++it)
+    {
+        unsigned cost = 0;
+        unsigned max_iuse_cost = 0;
+        for(global_t* member : *it)
+        {
+            cost += member->estimated_cost();
+            // Iuses within the SCC haven't been assigned a cost yet,
+            // so they don't count here.
+            for(global_t* iuse : member->m_iuses)
+                max_iuse_cost = std::max(max_iuse_cost, iuse->m_path_cost);
+        }
+
+        for(global_t* member : *it)
+            member->m_path_cost = cost + max_iuse_cost;
+    }
+
+    // Cycles never become ready by themselves, as each member waits on 
+    // the others. Have each SCC wait only on the ideps outside of it.
+    for(std::vector<global_t*>& members : sccs)
+    {
+        global_t* const leader = members.front();
+        if(members.size() == 1 && !leader->m_ideps.count(leader))
+            continue;
+
+        // Resident globals only use each other, so whole SCCs are kept.
+        if(leader->m_resident)
+            continue;
+
+        for(global_t* member : members)
+        {
+            if(member->m_gclass == GLOBAL_FN)
+                continue;
+
+            std::string names;
+            for(global_t* other : members)
+            {
+                if(!names.empty())
+                    names += ", ";
+                names += other->name;
+            }
+
+            file_contents_t file(member->m_pstring.file_i);
+            compiler_error(file, member->m_pstring, 
+                fmt("Global % depends on itself, through: %.", 
+                    member->name, names));
+        }
+
+        scc_t& scc = scc_pool.emplace_back();
+        scc.members = std::move(members);
+        for(global_t* member : scc.members)
+            member->m_scc = &scc;
+
+        // No member is compiled yet, so each counted the others.
+        unsigned waiting = 0;
+        for(global_t* member : scc.members)
+        {
+            for(global_t* idep : member->m_ideps)
+                if(idep->m_scc == &scc)
+                    --member->m_ideps_left;
+            if(member->m_ideps_left > 0)
+                ++waiting;
+        }
+
+        scc.members_waiting = waiting;
+        if(waiting == 0)
+            leader->make_ready(nullptr);
+    }
+
+    // Globals that became ready during parsing were queued without
+    // knowing their costs.
+    ready_queue->reprioritize();
+
+    // Every var is defined by now, so the set of them is final.
+    {
+        std::vector<unsigned> vars(num_vars());
+        std::iota(vars.begin(), vars.end(), 0);
+        all_vars_set = &gvar_set_t::intern(vars);
+    }
+
+    if(compiler_options().speculate)
+    {
+        global_pool.for_each([](global_t& global)
+        {
+            if(global.m_gclass == GLOBAL_FN && global.m_ideps_left > 0
+               && global.m_live && !global.m_scc)
+                speculation_candidates.push_back(&global);
+        });
+        std::sort(speculation_candidates.begin(), 
+                  speculation_candidates.end(),
+                  [](global_t* a, global_t* b) -> bool
+                  {
+                      return a->m_path_cost > b->m_path_cost;
+                  });
+    }
+
+    // Track which fns' summaries are still needed, and free what isn't.
+    // Dead fns never compile, so none of what they hold is needed.
+    for(global_t* global : globals)
+    {
+        if(global->m_gclass != GLOBAL_FN)
+            continue;
+
+        if(!global->m_live)
+        {
+            global->release_front_end();
+            continue;
+        }
 
-        global.m_ideps_left.store(global.m_ideps.size(), 
-                                  std::memory_order_relaxed);
-        for(global_t* idep : global.m_ideps)
-            idep->m_iuses.insert(&global);
+        // Fns written to a module need their summaries until the end.
+        // In watch mode, the next build needs them too.
+        unsigned users = !global->m_compiled;
+        if((!compiler_options().emit_module.empty() && !global->m_imported)
+           || compiler_options().watch)
+        {
+            ++users;
+        }
+        for(global_t* iuse : global->m_iuses)
+        {
+            if(iuse->m_live && !iuse->m_compiled
+               && !(global->m_scc && iuse->m_scc == global->m_scc))
+            {
+                ++users;
+            }
+        }
 
-        if(global.m_ideps.empty())
-            ready.push_back(&global);
+        global->m_users_left = users;
+        if(users == 0)
+            global->m_impl.fn->release_summaries();
     }
+    users_counted = true;
+
+    // Dead globals never compile, so the compile ends without them.
+    globals_total = num_live;
+    if(globals_compiled == num_live)
+        ready_queue->close();
 }
 
+unsigned global_t::estimated_cost() const
+{
+    // Compile time is dominated by fns, and roughly scales with their size.
+    if(m_gclass == GLOBAL_FN)
+        return 1 + m_impl.fn->num_stmts();
+    return 1;
+}
+
+namespace
+{
+    template<typename Fn>
+    bool run_pass(char const* name, Fn fn)
+    {
+        profile_scope_t scope(name);
+        return fn();
+    }
+
+    void optimize(ir_t& ir)
+    {
+        bool changed;
+        do
+        {
+            changed = false;
+            changed |= run_pass("o_phis", [&]{ return o_phis(ir); });
+            changed |= run_pass("o_abstract_interpret", 
+                                [&]{ return o_abstract_interpret(ir); });
+            changed |= run_pass("o_remove_unused_ssa", 
+                                [&]{ return o_remove_unused_ssa(ir); });
+        }
+        while(changed);
+    }
+} // end anon namespace
+
 void global_t::compile()
 {
+    profile_global_t profile_global(name);
+    mem_global_t mem_global(name);
+    trace_scope_t trace_scope;
+    profile_scope_t scope("compile");
+
     // Compile it!
     switch(gclass())
     {
@@ -140,45 +544,76 @@ void global_t::compile()
     case GLOBAL_FN:
         {
             // Compile the FN.
+            // Every var it can use has already been defined.
+            m_impl.fn->set_bitset_size(bitset_size<>(num_vars()));
+
+            // Imported fns come with their summaries.
+            if(m_imported)
+                break;
+
+            // Fns compiled under assumptions aren't cached,
+            // nor are SCC members, whose summaries depend on each other.
+            std::string cache_key;
+            if(compile_cache_enabled() && !fn_t::speculation && !m_scc)
+            {
+                profile_scope_t scope("compile_cache_load");
+                cache_key = compile_cache_key(*this);
+                if(compile_cache_load(cache_key, *m_impl.fn))
+                {
+                    release_front_end();
+                    break;
+                }
+            }
+
             ssa_pool::clear();
             cfg_pool::clear();
             ir_t ir;
-            build_ir(ir, *this);
+            {
+                profile_scope_t scope("build_ir");
+                build_ir(ir, *this);
+            }
             ir.assert_valid();
 
             if(compiler_options().optimize)
-            {
-                bool changed;
-                do
-                {
-                    changed = false;
-                    changed |= o_phis(ir);
-                    changed |= o_abstract_interpret(ir);
-                    changed |= o_remove_unused_ssa(ir);
-                }
-                while(changed);
-            }
+                optimize(ir);
 
             // Set the global's 'read' and 'write' bitsets:
-            m_impl.fn->calc_reads_writes_purity(ir);
+            {
+                profile_scope_t scope("calc_reads_writes_purity");
+                m_impl.fn->calc_reads_writes_purity(ir);
+            }
 
-            byteify(ir, *this);
+            {
+                profile_scope_t scope("byteify");
+                byteify(ir, *this);
+            }
             //make_conventional(ir);
 
             if(compiler_options().optimize)
+                optimize(ir);
+
             {
-                bool changed;
-                do
-                {
-                    changed = false;
-                    changed |= o_phis(ir);
-                    changed |= o_abstract_interpret(ir);
-                    changed |= o_remove_unused_ssa(ir);
-                }
-                while(changed);
+                profile_scope_t scope("code_gen");
+                code_gen(ir);
+            }
+
+            mem_high_water(MEM_ssa_pool, ssa_pool::capacity_bytes());
+            mem_high_water(MEM_cfg_pool, cfg_pool::capacity_bytes());
+            mem_high_water(MEM_ssa_data_pool, 
+                           ssa_data_pool::capacity_bytes());
+            mem_high_water(MEM_cfg_data_pool, 
+                           cfg_data_pool::capacity_bytes());
+
+            if(!cache_key.empty())
+            {
+                profile_scope_t scope("compile_cache_store");
+                compile_cache_store(cache_key, *m_impl.fn);
             }
 
-            code_gen(ir);
+            // The fn's definition isn't needed after this,
+            // unless the compile was speculative and has to be redone.
+            if(!fn_t::speculation)
+                release_front_end();
 
             /*
             for(cfg_ht cfg_it = ir.cfg_begin(); cfg_it; ++cfg_it)
@@ -229,67 +664,591 @@ void global_t::compile()
         // TODO
         break;
     }
+}
+
+namespace
+{
+    // Which of the ready queue's heaps this thread uses.
+    // Pool threads are persistent, so each keeps its heap across phases.
+    std::atomic<unsigned> next_worker_i = 0;
+
+    unsigned this_worker()
+    {
+        thread_local unsigned const worker_i = 
+            next_worker_i++ % compiler_options().num_threads;
+        return worker_i;
+    }
+}
+
+void global_t::init_ready_queue(unsigned num_workers)
+{
+    assert(!ready_queue);
+    ready_queue.reset(new ready_queue_t(num_workers));
+}
+
+void global_t::make_ready(global_t* released_by)
+{
+    m_released_by = released_by;
+    ready_queue->push(this_worker(), this);
+}
+
+void global_t::compile_then_release()
+{
+    m_compile_begin = std::chrono::steady_clock::now();
+    if(m_scc)
+        compile_scc();
+    else if(m_speculated)
+    {
+        // Unless the assumed callees were as bad as assumed, the output
+        // would depend on timing. Compile again with their real summaries.
+        if(m_impl.fn->speculation_held(*all_vars_set))
+        {
+            m_impl.fn->refine_speculation();
+            release_front_end();
+        }
+        else
+            compile();
+    }
+    else
+        compile();
+    m_compile_end = std::chrono::steady_clock::now();
+
+    if(!m_scc)
+    {
+        release_iuses(this);
+        release_ideps_summaries();
+    }
+    else
+    {
+        for(global_t* member : m_scc->members)
+        {
+            member->m_compile_begin = m_compile_begin;
+            member->m_compile_end = m_compile_end;
+            member->m_released_by = m_released_by;
+        }
+
+        // Every member has to be marked compiled before any users are
+        // released, as users outside the SCC may depend on several.
+        for(global_t* member : m_scc->members)
+            member->release_iuses(this);
+        for(global_t* member : m_scc->members)
+            member->release_ideps_summaries();
+    }
+}
+
+void global_t::release_front_end()
+{
+    assert(m_gclass == GLOBAL_FN);
+    if(!m_arena)
+        return;
+    m_impl.fn->release_def();
+    release_arena(m_arena);
+    m_arena = nullptr;
+}
+
+void global_t::release_ideps_summaries()
+{
+    // Users compiled before 'build_order' weren't counted.
+    if(!users_counted)
+        return;
+
+    for(global_t* idep : m_ideps)
+    {
+        if(idep->m_gclass != GLOBAL_FN || (m_scc && idep->m_scc == m_scc))
+            continue;
+        if(--idep->m_users_left == 0)
+            idep->m_impl.fn->release_summaries();
+    }
 
+    // The fn itself was counted too, in case it had no users.
+    if(m_gclass == GLOBAL_FN && --m_users_left == 0)
+        m_impl.fn->release_summaries();
+}
+
+void global_t::release_iuses(global_t* released_by)
+{
     // OK! The global is now compiled.
-    // Now add all its dependents onto the ready list:
+    // Users defined from now on won't wait on it, but those defined
+    // before have to be released.
+    bc::small_vector<global_t*, 16> iuses;
+    {
+        std::lock_guard<std::mutex> lock(m_define_mutex);
+        m_compiled = true;
+        iuses.assign(m_iuses.begin(), m_iuses.end());
+    }
+
+    // Add all its newly ready dependents onto our own heap,
+    // where they'll likely be compiled next, by this thread.
+    // Members of the same SCC were never waiting on each other.
+    for(global_t* iuse : iuses)
+        if(!m_scc || iuse->m_scc != m_scc)
+            iuse->release(released_by);
+
+    if(++globals_compiled == globals_total)
+        ready_queue->close();
+}
+
+void global_t::release(global_t* released_by)
+{
+    // Resident globals still get marked live.
+    if(m_resident)
+        return;
+
+    if(--m_ideps_left != 0)
+        return;
+
+    if(!m_scc)
+        make_ready(released_by);
+    else if(--m_scc->members_waiting == 0)
+        m_scc->members.front()->make_ready(released_by);
+}
+
+void global_t::compile_scc()
+{
+    assert(m_scc);
+
+    // Every member calls the others, whose summaries don't exist yet.
+    // Compile each assuming the worst of the others, like a speculative
+    // compile, then solve for the summaries and compile again where the
+    // worst didn't happen.
+    fn_t::speculation_t speculation;
+    speculation.all_vars = all_vars_set;
+    for(global_t* member : m_scc->members)
+        speculation.assumed.insert(member->m_impl.fn);
+
+    {
+        struct speculation_guard_t
+        {
+            ~speculation_guard_t() { fn_t::speculation = nullptr; }
+        } guard;
+        fn_t::speculation = &speculation;
+
+        for(global_t* member : m_scc->members)
+            member->compile();
+    }
+
+    // Solve on bitsets, then intern only the solution. Interned sets
+    // aren't freed until the build ends, and the steps towards the
+    // solution would never be used.
+    std::size_t const num_members = m_scc->members.size();
+    std::size_t const set_size = bitset_size<>(num_vars());
+    std::vector<bitset_uint_t> solved_reads(num_members * set_size);
+    std::vector<bitset_uint_t> solved_writes(num_members * set_size);
+    std::vector<bool> solved_io_pure(num_members);
+    fc::vector_map<fn_t const*, std::size_t> member_index;
+    for(std::size_t i = 0; i < num_members; ++i)
+    {
+        fn_t const& fn = *m_scc->members[i]->m_impl.fn;
+        member_index.emplace(&fn, i);
+        fn.reads().or_into(set_size, &solved_reads[i * set_size]);
+        fn.writes().or_into(set_size, &solved_writes[i * set_size]);
+        solved_io_pure[i] = fn.io_pure();
+    }
+
+    // ORs the callee's bitset into the member's, noting if anything
+    // was added.
+    bool changed;
+    auto const merge = [&](std::vector<bitset_uint_t>& sets,
+                           std::size_t member_i, std::size_t callee_i)
+    {
+        bitset_uint_t* const lhs = &sets[member_i * set_size];
+        bitset_uint_t const* const rhs = &sets[callee_i * set_size];
+        for(std::size_t j = 0; j < set_size; ++j)
+        {
+            changed |= (rhs[j] & ~lhs[j]) != 0;
+            lhs[j] |= rhs[j];
+        }
+    };
+
+    // The summaries only grow, so this terminates.
+    do
+    {
+        changed = false;
+        for(std::size_t i = 0; i < num_members; ++i)
+        {
+            fn_t const& fn = *m_scc->members[i]->m_impl.fn;
+            for(fn_t const* callee : fn.assumed_callees())
+            {
+                std::size_t const callee_i = member_index.find(callee)->second;
+                merge(solved_reads, i, callee_i);
+                merge(solved_writes, i, callee_i);
+                if(solved_io_pure[i] && !solved_io_pure[callee_i])
+                {
+                    solved_io_pure[i] = false;
+                    changed = true;
+                }
+            }
+        }
+    }
+    while(changed);
+
+    auto const intern_bitset = [set_size](bitset_uint_t const* bitset)
+        -> gvar_set_t const&
+    {
+        std::vector<unsigned> vars;
+        bitset_for_each(set_size, bitset,
+                        [&vars](unsigned var) { vars.push_back(var); });
+        return gvar_set_t::intern(vars);
+    };
 
-    global_t** newly_ready = ALLOCA_T(global_t*, m_iuses.size());
-    global_t** newly_ready_end = newly_ready;
+    for(std::size_t i = 0; i < num_members; ++i)
+    {
+        m_scc->members[i]->m_impl.fn->set_summaries(
+            intern_bitset(&solved_reads[i * set_size]),
+            intern_bitset(&solved_writes[i * set_size]),
+            solved_io_pure[i]);
+    }
 
-    for(global_t* iuse : m_iuses)
-        if(--iuse->m_ideps_left == 0)
-            *(newly_ready_end++) = iuse;
+    // Members whose callees came out better than the worst get compiled
+    // once more, using the solved summaries.
+    // Those summaries are kept afterwards, as each recompile has to see
+    // the same ones, and the other members were solved against them.
+    for(global_t* member : m_scc->members)
+    {
+        fn_t& fn = *member->m_impl.fn;
+        if(!fn.speculation_held(*all_vars_set))
+        {
+            gvar_set_t const& reads = fn.reads();
+            gvar_set_t const& writes = fn.writes();
+            bool const io_pure = fn.io_pure();
+            member->compile();
+            fn.set_summaries(reads, writes, io_pure);
+        }
+        member->release_front_end();
+    }
+}
+
+bool global_t::compile_speculatively()
+{
+    assert(compiler_phase() == PHASE_COMPILE);
+    assert(m_gclass == GLOBAL_FN);
+
+    // Count the speculative compile as one more thing to wait on,
+    // so the global can't be released while it's running.
+    unsigned left = m_ideps_left.load();
+    do
+    {
+        if(left == 0)
+            return false;
+    }
+    while(!m_ideps_left.compare_exchange_weak(left, left + 1));
 
-    unsigned new_globals_left;
+    // Every var is defined by now, so 'all_vars_set' covers
+    // whatever the assumed callees can touch.
+    fn_t::speculation_t speculation;
+    speculation.all_vars = all_vars_set;
 
+    // Fix which callees to assume, as they may finish mid-compile.
+    for(global_t* idep : m_ideps)
     {
-        std::lock_guard lock(ready_mutex);
-        ready.insert(ready.end(), newly_ready, newly_ready_end);
-        new_globals_left = --globals_left;
+        if(idep->m_gclass != GLOBAL_FN)
+            continue;
+        std::lock_guard<std::mutex> lock(idep->m_define_mutex);
+        if(!idep->m_compiled)
+            speculation.assumed.insert(idep->m_impl.fn);
     }
 
-    if(newly_ready_end != newly_ready || new_globals_left == 0)
-        ready_cv.notify_all();
+    struct speculation_guard_t
+    {
+        ~speculation_guard_t() { fn_t::speculation = nullptr; }
+    } guard;
+    fn_t::speculation = &speculation;
+
+    compile();
+    m_speculated = true;
+
+    release(nullptr);
+    return true;
 }
 
-global_t* global_t::await_ready_global()
+bool global_t::speculate_one()
 {
-    std::unique_lock<std::mutex> lock(ready_mutex);
-    ready_cv.wait(lock, []{ return globals_left == 0 || !ready.empty(); });
+    unsigned i;
+    while((i = next_speculation_i++) < speculation_candidates.size())
+        if(speculation_candidates[i]->compile_speculatively())
+            return true;
+    return false;
+}
 
-    if(globals_left == 0)
-        return nullptr;
-    
-    global_t* ret = ready.back();
-    ready.pop_back();
-    return ret;
+bool global_t::compile_one_ready()
+{
+    global_t* global;
+    if(!ready_queue->try_pop(this_worker(), global))
+        return false;
+    global->compile_then_release();
+    return true;
+}
+
+bool global_t::wait_for_ready(global_t*& global)
+{
+    profile_scope_t scope("wait");
+    return ready_queue->pop(this_worker(), global);
 }
 
 void global_t::compile_all()
 {
-    globals_left = global_pool.size();
+    if(ready_queue->is_closed())
+        return;
 
     // Spawn threads to compile in parallel:
     parallelize(compiler_options().num_threads,
     [](std::atomic<bool>& exception_thrown)
     {
-        while(!exception_thrown)
+        try
+        {
+            global_t* global;
+            while(!exception_thrown)
+            {
+                // When there's nothing ready, speculate instead of waiting.
+                if(ready_queue->try_pop(this_worker(), global)
+                   || (!speculate_one() && wait_for_ready(global)))
+                {
+                    global->compile_then_release();
+                }
+                else if(ready_queue->is_closed())
+                    break;
+            }
+        }
+        catch(...)
+        {
+            // Wake the parked workers, so they can exit too.
+            ready_queue->close();
+            throw;
+        }
+    });
+}
+
+void global_t::report_critical_path(std::ostream& o)
+{
+    using namespace std::chrono;
+
+    // Start from whichever global finished last, then walk backwards
+    // through whatever it was waiting on.
+    global_t* last = nullptr;
+    global_pool.for_each([&last](global_t& global)
+    {
+        if(!last || global.m_compile_end > last->m_compile_end)
+            last = &global;
+    });
+
+    if(!last)
+        return;
+
+    std::vector<global_t const*> path;
+    for(global_t const* global = last; global; global = global->m_released_by)
+        path.push_back(global);
+
+    auto const ms = [](steady_clock::duration d) -> double
+        { return duration<double, std::milli>(d).count(); };
+
+    steady_clock::duration compiling = {};
+    for(global_t const* global : path)
+        compiling += global->m_compile_end - global->m_compile_begin;
+
+    o << fmt("Critical path: % globals, %ms compiling, %ms total\n", 
+             path.size(), ms(compiling),
+             ms(last->m_compile_end - path.back()->m_compile_begin));
+    for(auto it = path.rbegin(); it != path.rend(); ++it)
+    {
+        global_t const& global = **it;
+        o << fmt("  %ms (waited %ms) %\n", 
+                 ms(global.m_compile_end - global.m_compile_begin),
+                 global.m_released_by
+                 ? ms(global.m_compile_begin 
+                      - global.m_released_by->m_compile_end) 
+                 : 0.0,
+                 global.name);
+    }
+}
+
+void global_t::reset()
+{
+    global_pool.clear();
+    fn_pool.clear();
+    scc_pool.clear();
+    entry_points.clear();
+    speculation_candidates.clear();
+    next_speculation_i = 0;
+
+    free_arenas.clear();
+    arena_pool.clear();
+
+    for(auto& block : var_blocks)
+        block.reset();
+    var_count = 0;
+
+    ready_queue.reset();
+    all_vars_set = nullptr;
+    users_counted = false;
+    globals_compiled = 0;
+    globals_total = ~0u;
+
+    gvar_set_t::collect({});
+}
+
+bool global_t::reset_files(std::vector<bool>& files)
+{
+    auto const in_files = [&files](global_t const& global) -> bool
+    {
+        return (global.m_gclass != GLOBAL_UNDEFINED && !global.m_imported
+                && files[global.m_pstring.file_i]);
+    };
+
+    // Dead fns had their definitions freed without compiling,
+    // so their files have to be parsed again.
+    global_pool.for_each([&files](global_t& global)
+    {
+        if(global.m_gclass != GLOBAL_UNDEFINED && !global.m_imported
+           && !global.m_compiled)
         {
-            global_t* global = await_ready_global();
-            if(!global)
+            files[global.m_pstring.file_i] = true;
+        }
+    });
+
+    // Add the files of users, until there's none left to add.
+    bool added;
+    do
+    {
+        added = false;
+        global_pool.for_each([&](global_t& global)
+        {
+            if(!in_files(global))
                 return;
-            global->compile();
+            for(global_t* iuse : global.m_iuses)
+            {
+                if(!files[iuse->m_pstring.file_i])
+                {
+                    files[iuse->m_pstring.file_i] = true;
+                    added = true;
+                }
+            }
+        });
+    }
+    while(added);
+
+    // Var indices are in every summary, so vars can't be undefined.
+    bool has_vars = false;
+    global_pool.for_each([&](global_t& global)
+    {
+        has_vars |= in_files(global) && global.m_gclass == GLOBAL_VAR;
+    });
+    if(has_vars)
+        return false;
+
+    // Globals are undefined after this, so find them all first.
+    std::vector<global_t*> undefined;
+    global_pool.for_each([&](global_t& global)
+    {
+        if(in_files(global) || global.m_gclass == GLOBAL_UNDEFINED)
+            undefined.push_back(&global);
+    });
+
+    global_pool.for_each([](global_t& global)
+    {
+        global.m_live = compiler_options().entry_points.empty();
+        global.m_dfs_index = global.m_dfs_lowlink = 0;
+        global.m_on_dfs_stack = false;
+        global.m_scc = nullptr;
+        global.m_speculated = false;
+        global.m_users_left = 0;
+        global.m_path_cost = 0;
+        global.m_released_by = nullptr;
+        global.m_compile_begin = global.m_compile_end = {};
+        global.m_resident = true;
+        global.m_ideps_left = 0;
+    });
+
+    // The globals undefined get defined again the same way new ones are,
+    // except that their fns stay in 'fn_pool' until the next 'reset'.
+    for(global_t* global : undefined)
+    {
+        assert(!global->m_arena);
+        for(global_t* idep : global->m_ideps)
+            idep->m_iuses.erase(global);
+        global->m_ideps.clear();
+        if(global->m_gclass == GLOBAL_FN)
+            global->m_impl.fn->release_summaries();
+        global->m_gclass = GLOBAL_UNDEFINED;
+        global->m_type = TYPE_VOID;
+        global->m_impl = {};
+        global->m_compiled = false;
+        global->m_resident = false;
+        global->m_redefining = true;
+        global->m_ideps_left = global->m_live ? 1 : 2;
+    }
+
+    scc_pool.clear();
+    entry_points.clear();
+    speculation_candidates.clear();
+    next_speculation_i = 0;
+
+    ready_queue.reset();
+    all_vars_set = nullptr;
+    users_counted = false;
+    globals_compiled = 0;
+    globals_total = ~0u;
+
+    // Only the summaries of the fns kept are used from now on.
+    std::vector<gvar_set_t const**> summaries;
+    global_pool.for_each([&summaries](global_t& global)
+    {
+        if(global.m_gclass == GLOBAL_FN)
+            global.m_impl.fn->summary_refs(summaries);
+    });
+    gvar_set_t::collect(summaries);
+
+    return true;
+}
+
+void global_t::report_reachability(std::ostream& o)
+{
+    using namespace std::chrono;
+
+    unsigned num_globals = 0;
+    unsigned num_dead = 0;
+    unsigned dead_fns = 0;
+    unsigned live_cost = 0;
+    unsigned dead_cost = 0;
+    std::size_t dead_stmts = 0;
+    steady_clock::duration compiling = {};
+    global_pool.for_each([&](global_t& global)
+    {
+        ++num_globals;
+        if(global.m_live)
+        {
+            live_cost += global.estimated_cost();
+            compiling += global.m_compile_end - global.m_compile_begin;
+            return;
+        }
+
+        ++num_dead;
+        dead_cost += global.estimated_cost();
+        if(global.m_gclass == GLOBAL_FN)
+        {
+            ++dead_fns;
+            dead_stmts += global.m_impl.fn->num_stmts();
         }
     });
+
+    // SCC members share their compile time, so this overcounts them.
+    // It's only an estimate anyway.
+    double const saved_ms = live_cost == 0 ? 0.0 : 
+        duration<double, std::milli>(compiling).count() 
+        * dead_cost / live_cost;
+
+    o << fmt("Unreachable: % of % globals, % fns, % stmts skipped, "
+             "saving an estimated %ms of compiling\n",
+             num_dead, num_globals, dead_fns, dead_stmts, saved_ms);
 }
 
 void fn_t::calc_reads_writes_purity(ir_t const& ir)
 {
-    unsigned const set_size = bitset_size<>(global_t::num_vars());
-
-    bitset_uint_t* writes = bitset_pool.alloc(set_size);
-    bitset_uint_t* reads  = bitset_pool.alloc(set_size);
+    // Collect the vars unsorted, with duplicates, then intern them.
+    // This scales with the number of accesses, not the number of vars.
+    std::vector<unsigned> writes;
+    std::vector<unsigned> reads;
     bool io_pure = true;
+    m_assumed_callees.clear();
 
     for(cfg_ht cfg_it = ir.cfg_begin(); cfg_it; ++cfg_it)
     for(ssa_ht ssa_it = cfg_it->ssa_begin(); ssa_it; ++ssa_it)
@@ -300,7 +1259,7 @@ void fn_t::calc_reads_writes_purity(ir_t const& ir)
         if(ssa_flags(ssa_it->op()) & SSAF_WRITE_GLOBALS)
         {
             for_each_written_global(ssa_it,
-            [this, writes](ssa_value_t def, locator_t loc)
+            [&writes](ssa_value_t def, locator_t loc)
             {
                 if(loc.lclass() == LCLASS_GLOBAL)
                 {
@@ -313,7 +1272,7 @@ void fn_t::calc_reads_writes_purity(ir_t const& ir)
                        || def->op() != SSA_read_global
                        || def->input(1).locator() != loc)
                     {
-                        bitset_set(writes, written.var().value);
+                        writes.push_back(written.var().value);
                     }
                 }
             });
@@ -336,7 +1295,7 @@ void fn_t::calc_reads_writes_purity(ir_t const& ir)
                     if(!is_locator_write(oe)
                        || oe.handle->input(oe.index + 1) != loc)
                     {
-                        bitset_set(reads, read.var().value);
+                        reads.push_back(read.var().value);
                         break;
                     }
                 }
@@ -348,18 +1307,58 @@ void fn_t::calc_reads_writes_purity(ir_t const& ir)
 
             assert(callee.gclass() == GLOBAL_FN);
 
-            bitset_or(set_size, writes, callee.fn().writes());
-            bitset_or(set_size, reads,  callee.fn().reads());
+            // Assumed callees get added by 'refine_speculation'.
+            if(callee.fn().is_assumed())
+            {
+                m_assumed_callees.push_back(&callee.fn());
+                continue;
+            }
+
+            callee.fn().writes().append_to(writes);
+            callee.fn().reads().append_to(reads);
             io_pure &= callee.fn().io_pure();
         }
     }
 
+    m_writes = &gvar_set_t::intern(writes);
+    m_reads  = &gvar_set_t::intern(reads);
+    m_io_pure = io_pure;
+}
+
+void fn_t::refine_speculation()
+{
+    assert(!speculation);
+
+    if(m_assumed_callees.empty())
+        return;
+
+    std::vector<unsigned> reads;
+    std::vector<unsigned> writes;
+    m_reads->append_to(reads);
+    m_writes->append_to(writes);
+    bool io_pure = m_io_pure;
+
+    for(fn_t const* callee : m_assumed_callees)
     {
-        std::lock_guard<std::mutex> lock(bitset_pool_mutex);
-        m_writes = writes;
-        m_reads  = reads;
-        m_io_pure = io_pure;
+        callee->reads().append_to(reads);
+        callee->writes().append_to(writes);
+        io_pure &= callee->io_pure();
     }
+
+    m_reads = &gvar_set_t::intern(reads);
+    m_writes = &gvar_set_t::intern(writes);
+    m_io_pure = io_pure;
+}
+
+bool fn_t::speculation_held(gvar_set_t const& all_vars) const
+{
+    assert(!speculation);
+
+    for(fn_t const* callee : m_assumed_callees)
+        if(&callee->reads() != &all_vars || &callee->writes() != &all_vars
+           || callee->io_pure())
+            return false;
+    return true;
 }
 
 std::string to_string(global_class_t gclass)
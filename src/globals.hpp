@@ -1,7 +1,9 @@
 #ifndef GLOBALS_HPP
 #define GLOBALS_HPP
 
-#include <condition_variable>
+#include <array>
+#include <chrono>
+#include <memory>
 #include <mutex>
 #include <ostream>
 #include <deque>
@@ -12,16 +14,21 @@
 #include "flat/flat_set.hpp"
 
 #include "array_pool.hpp"
+#include "atom.hpp"
 #include "bitset.hpp"
 #include "file.hpp"
+#include "gvar_set.hpp"
 #include "handle.hpp"
 #include "ir.hpp"
+#include "options.hpp"
 #include "parser_types.hpp"
 #include "phase.hpp"
 #include "ram.hpp"
+#include "sharded_pool.hpp"
 #include "stmt.hpp"
 #include "symbol_table.hpp"
 #include "types.hpp"
+#include "work_queue.hpp"
 
 namespace bc = boost::container;
 
@@ -43,12 +50,14 @@ std::string to_string(global_class_t gclass);
 using gvar_ht = handle_t<unsigned, struct gvar_ht_tag, ~0>;
 class fn_t;
 class fn_def_t;
+struct scc_t;
 
 struct global_t
 {
 public:
     using ideps_set_t = fc::vector_set<global_t*>;
-    std::string const name;
+    atom_ht const atom;
+    std::string_view const name;
 private:
     // These variables are set only by 'define', as soon
     // as the global is parsed.
@@ -68,57 +77,171 @@ private:
     ideps_set_t m_ideps;
 
     // Likewise, 'iuses' holds the immediate users of this global.
-    // This is built after all globals have been created, after parsing.
+    // Users add themselves to it when they're defined,
+    // under 'm_define_mutex'.
     ideps_set_t m_iuses;
-    std::atomic<unsigned> m_ideps_left = 0;
+
+    // Set once the global is compiled, under 'm_define_mutex'.
+    bool m_compiled = false;
+
+    // Set if the global was defined by a module, rather than parsed.
+    bool m_imported = false;
+
+    // Set once the global is known to be used by an entry point, 
+    // under 'm_define_mutex'.
+    // Without entry points, every global is live.
+    bool m_live;
+
+    // Counts what the global is waiting on before it can compile:
+    // its own definition, plus every idep not yet compiled,
+    // plus being live.
+    // It enters the ready queue when this hits 0.
+    std::atomic<unsigned> m_ideps_left;
+
+    // Scratch space for 'build_order', finding cycles.
+    unsigned m_dfs_index = 0;
+    unsigned m_dfs_lowlink = 0;
+    bool m_on_dfs_stack = false;
+
+    // Globals that depend on each other in a cycle share an SCC,
+    // and are compiled together, by whichever member is queued.
+    // This is set by 'build_order'.
+    scc_t* m_scc = nullptr;
+
+    // Set once the global has been compiled speculatively.
+    bool m_speculated = false;
+
+    // In watch mode, set on globals kept compiled from the previous build
+    // by 'reset_files'. They're never queued again.
+    bool m_resident = false;
+
+    // Set on globals undefined by 'reset_files', until they're parsed
+    // again. Those that aren't were removed from the source.
+    bool m_redefining = false;
+
+    // For fns, counts the live users not yet compiled, plus the fn
+    // itself if it isn't compiled. Its summaries are freed at 0.
+    // This is set by 'build_order', and only counts down after it.
+    std::atomic<unsigned> m_users_left = 0;
+
+    // The arena holding the fn's expressions and labels.
+    struct arena_t;
+    arena_t* m_arena = nullptr;
+
+    // The estimated cost of compiling this global, plus that of its most
+    // expensive chain of users. Globals with the highest cost are on the
+    // critical path, and get compiled first.
+    // This is set by 'build_order'.
+    unsigned m_path_cost = 0;
+
+    // Used to report the critical path after compiling:
+    // The idep that finished last, letting this global compile.
+    global_t* m_released_by = nullptr;
+    std::chrono::steady_clock::time_point m_compile_begin;
+    std::chrono::steady_clock::time_point m_compile_end;
 
 public:
-    global_t(pstring_t pstring, char const* source)
-    : name(pstring.view(source))
+    global_t(atom_ht atom, pstring_t pstring)
+    : atom(atom)
+    , name(atom_name(atom))
     , m_pstring(pstring)
+    , m_live(compiler_options().entry_points.empty())
+    , m_ideps_left(m_live ? 1 : 2)
     {}
 
-    global_class_t gclass() const 
-    { 
-        assert(compiler_phase() > PHASE_PARSE);
-        return m_gclass;
-    }
+    // Compiling overlaps with parsing, so these can be called during
+    // PHASE_PARSE, but only on globals that are known to be defined.
+    // (Such as the ideps of a global that's compiling.)
 
-    type_t type() const
-    { 
-        assert(compiler_phase() > PHASE_PARSE);
-        return m_type; 
-    }
+    global_class_t gclass() const { return m_gclass; }
+    type_t type() const { return m_type; }
 
     fn_t const& fn() const 
     { 
-        assert(compiler_phase() > PHASE_PARSE);
         assert(gclass() == GLOBAL_FN); 
         return *m_impl.fn;
     }
 
     gvar_ht var() const 
     { 
-        assert(compiler_phase() > PHASE_PARSE);
         assert(gclass() == GLOBAL_VAR); 
         return { m_impl.index };
     }
 
-    ideps_set_t const& ideps() const
-    {
-        assert(compiler_phase() > PHASE_PARSE);
-        return m_ideps;
-    }
+    ideps_set_t const& ideps() const { return m_ideps; }
+
+    // Only valid once compiling is done.
+    bool compiled() const { return m_compiled; }
+    bool imported() const { return m_imported; }
 
     fn_t& define_fn(pstring_t pstring, type_t type, 
                     global_t::ideps_set_t&& ideps, fn_def_t&& fn_def);
     gvar_ht define_var(pstring_t pstring, type_t type,
                        global_t::ideps_set_t&& ideps);
 
+    // Defines a global compiled by another program, read from a module.
+    // Imported globals have no ideps, and are compiled as soon as
+    // they're defined.
+    fn_t& import_fn(type_t type, gvar_set_t const& reads, 
+                    gvar_set_t const& writes, bool io_pure);
+    gvar_ht import_var(type_t type);
+
 private:
     void define(pstring_t pstring, global_class_t gclass, type_t type, 
                 impl_t impl, ideps_set_t&& ideps);
     void compile();
+
+    // Orders the ready globals, highest 'm_path_cost' first.
+    struct path_cost_less_t
+    {
+        bool operator()(global_t const* a, global_t const* b) const
+            { return a->m_path_cost < b->m_path_cost; }
+    };
+
+    using ready_queue_t = work_queue_t<global_t*, path_cost_less_t>;
+
+    // Compiles the global, then queues those of its users that were
+    // waiting on it last.
+    void compile_then_release();
+
+    // Compiles every member of 'm_scc' together.
+    void compile_scc();
+
+    // Marks one more idep as compiled, queueing the global
+    // (or its SCC) once nothing is left.
+    void release(global_t* released_by);
+
+    // Marks the global as compiled, then releases its users.
+    void release_iuses(global_t* released_by);
+
+    // Compiles the global before its ideps finish compiling,
+    // if it's still waiting on them.
+    // Returns false if the global wasn't waiting.
+    bool compile_speculatively();
+
+    // Claims the next waiting global on the critical path and compiles
+    // it speculatively. Returns false if there was nothing to claim.
+    static bool speculate_one();
+
+    // Blocks until a global is ready, returning false once the queue
+    // is closed.
+    static bool wait_for_ready(global_t*& global);
+
+    // Queues the global to be compiled by this thread's worker.
+    void make_ready(global_t* released_by);
+
+    // Marks the global and everything it uses as live.
+    void mark_live();
+
+    // Frees what the parser created for the fn, once it's compiled.
+    void release_front_end();
+
+    // Called once the global is compiled, to free the summaries
+    // of ideps that no one needs anymore.
+    void release_ideps_summaries();
+
+    // An estimate of how long the global takes to compile.
+    unsigned estimated_cost() const;
 public:
     // Allocates an expression.
     static token_t const* new_expr(token_t const* begin, token_t const* end);
@@ -126,63 +249,171 @@ public:
 
     // Creates a global if it doesn't exist,
     // otherwise returns the existing global with name.
-    static global_t& lookup(pstring_t name, char const* source);
+    // 'pstring' is only used when creating.
+    static global_t& lookup(atom_ht name, pstring_t pstring);
+
+    // Returns the global with name, or nullptr if there isn't one.
+    static global_t* find(atom_ht name);
 
     // Looks up a global variable given a gvar_ht index.
-    // This function can only be called after 'var_vec' is 100% built.
-    inline static global_t& lookup(gvar_ht gvar)
-    {
-        assert(compiler_phase() > PHASE_PARSE);
-        return *var_vec[gvar.value];
-    }
+    inline static global_t& lookup(gvar_ht gvar) { return get_var(gvar); }
 
+    // The number of vars defined so far.
+    // This only grows until parsing ends.
     inline static std::size_t num_vars() 
     { 
-        assert(compiler_phase() > PHASE_PARSE);
-        return var_vec.size();
+        return var_count.load(std::memory_order_acquire);
     }
 
     inline static global_t& get_var(gvar_ht vh)
     { 
-        assert(compiler_phase() > PHASE_PARSE);
-        assert(vh.value < var_vec.size());
-        return *var_vec[vh.value];
+        assert(vh.value < num_vars());
+        return *var_blocks[vh.value >> var_block_bits]
+                          [vh.value & (var_block_size - 1)];
     }
 
-    // Call after parsing to build 'm_iuses' and 'm_ideps_left',
-    // among other things.
+    // The bytes held by the table of globals, roughly.
+    static std::size_t table_memory_size() 
+        { return global_pool.memory_size(); }
+
+    // Calls 'fn' on every global.
+    // This function isn't thread-safe.
+    template<typename Fn>
+    static void for_each(Fn fn) { global_pool.for_each(fn); }
+
+    // Roots the live globals at 'name'.
+    // Call before parsing, once per entry point.
+    static void add_entry_point(std::string_view name);
+
+    // Parsers allocate expressions and labels from an arena per chunk.
+    // Create one of these for each chunk parsed, on the parsing thread.
+    // The arena gets recycled once the chunk is parsed, and every fn
+    // defined in it has compiled.
+    class parse_arena_t
+    {
+    public:
+        parse_arena_t();
+        ~parse_arena_t();
+        parse_arena_t(parse_arena_t const&) = delete;
+        parse_arena_t& operator=(parse_arena_t const&) = delete;
+    };
+
+    // Compiling overlaps with parsing: globals enter the ready queue
+    // as soon as they're defined and all their ideps are compiled.
+    // Call before parsing.
+    static void init_ready_queue(unsigned num_workers);
+
+    // Compiles one ready global, without waiting for one.
+    // Returns false if there was nothing to compile.
+    // Parser threads call this between chunks.
+    static bool compile_one_ready();
+
+    // Call after parsing to check that every global was defined,
+    // and to prioritize the remaining globals.
     // This function isn't thread-safe.
     // Call from a single thread only.
     static void build_order();
 
-    // Call after 'build_order' to well... compile everything!
+    // Call after 'build_order' to well... compile everything else!
     static void compile_all();
 
+    // Call after 'compile_all' to print the chain of globals that
+    // the compile waited on the longest.
+    static void report_critical_path(std::ostream& o);
+
+    // Call after 'compile_all' to print how much was skipped
+    // for being unreachable from the entry points.
+    static void report_reachability(std::ostream& o);
+
+    // Destroys every global, so that the program can be compiled again.
+    // Atoms, types, and summaries are interned elsewhere, and stay.
+    // This function isn't thread-safe.
+    static void reset();
+
+    // An alternative to 'reset' for watch mode, after a build succeeded.
+    // Undefines the globals of the files in 'files', which holds those
+    // that changed, so they can be parsed again. The rest stay compiled.
+    // Files defining users of the undefined globals get added to 'files',
+    // so that the globals kept only use each other.
+    // Returns false if the globals can't be kept, as a var would be
+    // undefined, in which case call 'reset' and parse every file.
+    // This function isn't thread-safe.
+    static bool reset_files(std::vector<bool>& files);
+
 private:
-    // Returns and pops the next ready global from the ready list.
-    static global_t* await_ready_global();
-private:
-    inline static std::mutex label_pool_mutex;
-    inline static array_pool_t<label_t> label_pool;
+    // Each parser thread allocates labels and expressions from its own 
+    // arena, so that parser threads don't contend on a lock.
+    // The arenas are owned by 'arena_pool' rather than by the threads,
+    // so their contents live as long as the fns using them do.
+    struct arena_t
+    {
+        array_pool_t<label_t> label_pool;
+        array_pool_t<token_t> expr_pool;
+
+        // The chunk's parser, plus each fn defined in it that 
+        // hasn't compiled.
+        std::atomic<unsigned> refs = 0;
+    };
+
+    // The arena of the chunk this thread is parsing.
+    inline static thread_local arena_t* parse_arena = nullptr;
 
-    inline static std::mutex expr_pool_mutex;
-    inline static array_pool_t<token_t> expr_pool;
+    static arena_t& local_arena();
+    static arena_t* acquire_arena();
+    static void release_arena(arena_t* arena);
 
-    inline static std::mutex global_pool_mutex;
-    inline static rh::robin_auto_table<global_t*> global_pool_map;
-    static std::deque<global_t> global_pool;
+    inline static std::mutex arena_pool_mutex; // Protects the objects below:
+    static std::deque<arena_t> arena_pool;
+    static std::vector<arena_t*> free_arenas;
+
+    static sharded_pool_t<global_t> global_pool;
 
     inline static std::mutex fn_pool_mutex;
     static std::deque<fn_t> fn_pool;
 
+    // Maps gvar_ht to globals.
+    // Vars get defined while other threads compile, so they're stored 
+    // in blocks that never move, and published through 'var_count'.
+    static constexpr unsigned var_block_bits = 10;
+    static constexpr unsigned var_block_size = 1 << var_block_bits;
     inline static std::mutex var_vec_mutex;
-    static std::vector<global_t*> var_vec;
+    inline static std::array<std::unique_ptr<global_t*[]>, 1 << 12> 
+        var_blocks;
+    inline static std::atomic<unsigned> var_count = 0;
+
+    inline static std::unique_ptr<ready_queue_t> ready_queue;
 
-    // These represent a queue globals ready to be compiled.
-    inline static std::condition_variable ready_cv;
-    inline static std::mutex ready_mutex;
-    static std::vector<global_t*> ready;
-    inline static unsigned globals_left;
+    static std::deque<scc_t> scc_pool;
+
+    static std::vector<global_t*> entry_points;
+
+    // Fns still waiting on their ideps after parsing, which can be 
+    // compiled speculatively, highest 'm_path_cost' first.
+    static std::vector<global_t*> speculation_candidates;
+    inline static std::atomic<unsigned> next_speculation_i = 0;
+
+    // Every var, as fns not compiled yet are assumed to use them all.
+    // This is set by 'build_order', once every var is defined.
+    inline static gvar_set_t const* all_vars_set = nullptr;
+
+    // Set by 'build_order' once 'm_users_left' is counted.
+    inline static bool users_counted = false;
+
+    // Once 'build_order' knows how many globals there are,
+    // the queue gets closed when they've all been compiled.
+    inline static std::atomic<unsigned> globals_compiled = 0;
+    inline static std::atomic<unsigned> globals_total = ~0u;
+};
+
+// A strongly connected component of the dependency graph,
+// AKA a set of globals that all depend on each other.
+struct scc_t
+{
+    std::vector<global_t*> members;
+
+    // Counts members still waiting on ideps outside the SCC.
+    // The SCC is queued when this hits 0.
+    std::atomic<unsigned> members_waiting = 0;
 };
 
 class fn_def_t
@@ -217,7 +448,10 @@ public:
 class fn_t
 {
 public:
-    explicit fn_t(fn_def_t fn_def) : def(std::move(fn_def)) {}
+    explicit fn_t(fn_def_t fn_def) 
+    : def(std::move(fn_def))
+    , m_num_stmts(def.stmts.size())
+    {}
 
     // TODO
     //std::vector<type_t> arg_bytes_types;
@@ -226,29 +460,120 @@ public:
 
     void calc_reads_writes_purity(ir_t const& ir);
 
+    // The size of bitsets over the vars the fn can use.
+    // This gets fixed to the number of vars defined when the fn starts
+    // compiling, as the fn can't use vars defined later.
+    // Callers compile after their callees, so their bitsets are as large
+    // or larger.
+    unsigned bitset_size() const { return m_bitset_size; }
+    void set_bitset_size(unsigned size) { m_bitset_size = size; }
+
     // These are only valid after 'calc_reads_writes_purity' has ran.
-    bitset_uint_t const* reads() const  { assert(m_reads);  return m_reads; }
-    bitset_uint_t const* writes() const { assert(m_writes); return m_writes; }
-    bool io_pure() const { assert(m_writes); return m_io_pure; }
+    gvar_set_t const& reads() const  
+    { 
+        if(speculation_t const* s = assumed())
+            return *s->all_vars;
+        assert(m_reads);  
+        return *m_reads; 
+    }
+
+    gvar_set_t const& writes() const 
+    { 
+        if(speculation_t const* s = assumed())
+            return *s->all_vars;
+        assert(m_writes); 
+        return *m_writes; 
+    }
+
+    bool io_pure() const 
+    { 
+        if(assumed())
+            return false;
+        assert(m_writes); 
+        return m_io_pure; 
+    }
+
+    // Set while this thread compiles a fn speculatively, before all of
+    // its callees are compiled. Those callees get conservative summaries:
+    // they read and write every var, and aren't pure.
+    struct speculation_t
+    {
+        fc::vector_set<fn_t const*> assumed;
+        gvar_set_t const* all_vars;
+    };
+    inline static thread_local speculation_t const* speculation = nullptr;
+
+    // After a speculative compile, adds the summaries of the callees
+    // that were assumed, once they exist.
+    void refine_speculation();
+
+    // Whether every assumed callee turned out as conservative as assumed,
+    // reading and writing all of 'all_vars' and impure.
+    // If so, the speculative compile is what a normal one would produce,
+    // otherwise the fn has to be compiled again.
+    bool speculation_held(gvar_set_t const& all_vars) const;
+
+    bool is_assumed() const { return assumed(); }
+
+    // Callees that the last compile assumed the worst of.
+    std::vector<fn_t const*> const& assumed_callees() const
+        { return m_assumed_callees; }
+
+    // How many statements 'def' had, before it was released.
+    unsigned num_stmts() const { return m_num_stmts; }
+
+    // Sets the summaries without compiling, such as from a cache.
+    void set_summaries(gvar_set_t const& reads, gvar_set_t const& writes,
+                       bool io_pure)
+    {
+        m_reads = &reads;
+        m_writes = &writes;
+        m_io_pure = io_pure;
+    }
+
+    // Frees 'def'. Only the fn's own compile uses it.
+    void release_def() { def = fn_def_t(); }
+
+    // Drops 'reads' and 'writes', once every user is compiled.
+    // The sets themselves are interned, and shared between fns.
+    void release_summaries() { m_reads = m_writes = nullptr; }
+
+    // Appends the summaries held, for 'gvar_set_t::collect'.
+    void summary_refs(std::vector<gvar_set_t const**>& refs)
+    {
+        if(m_reads)
+            refs.push_back(&m_reads);
+        if(m_writes)
+            refs.push_back(&m_writes);
+    }
 
 public:
-    fn_def_t const def;
+    fn_def_t def;
 private:
-    // Bitsets of all global vars read/written in fn (deep)
+    unsigned m_num_stmts = 0;
+
+    // Sets of all global vars read/written in fn (deep)
     // These get assigned by 'calc_reads_writes_purity'.
     // The thread synchronization is implicit in the order of compilation.
-    bitset_uint_t* m_reads = nullptr;
-    bitset_uint_t* m_writes = nullptr;
+    gvar_set_t const* m_reads = nullptr;
+    gvar_set_t const* m_writes = nullptr;
+    unsigned m_bitset_size = 0;
+
+    // Callees that 'calc_reads_writes_purity' left out of the summaries,
+    // as their own summaries weren't known yet.
+    std::vector<fn_t const*> m_assumed_callees;
+
+    speculation_t const* assumed() const
+    {
+        if(speculation && speculation->assumed.count(this))
+            return speculation;
+        return nullptr;
+    }
 
     // If the function doesn't modifies or I/O.
     // (Using mutable memory state is OK.)
     // Gets set by 'calc_reads_writes_purity'.
     bool m_io_pure = false;
-
-private:
-    // Holds bitsets of 'm_reads' and 'm_writes'
-    static inline std::mutex bitset_pool_mutex;
-    static inline array_pool_t<bitset_uint_t> bitset_pool;
 };
 
 #endif
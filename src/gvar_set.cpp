@@ -0,0 +1,141 @@
+#include "gvar_set.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <memory>
+
+#include "fnv1a.hpp"
+#include "sharded_pool.hpp"
+
+namespace
+{
+    using gvar_set_pool_t = sharded_pool_t<gvar_set_t>;
+
+    // Replaced whole by 'collect'.
+    std::unique_ptr<gvar_set_pool_t> gvar_set_pool =
+        std::make_unique<gvar_set_pool_t>();
+
+    std::uint32_t hash_vars(std::vector<unsigned> const& sorted)
+    {
+        std::uint32_t hash = fnv1a<std::uint32_t>::seed;
+        for(unsigned var : sorted)
+            hash = fnv1a<std::uint32_t>::hash(
+                reinterpret_cast<char const*>(&var), sizeof(var), hash);
+        return hash;
+    }
+} // end anon namespace
+
+gvar_set_t::gvar_set_t(std::uint32_t hash, std::vector<unsigned> const& vars)
+: m_hash(hash)
+, m_size(vars.size())
+{
+    if(vars.empty())
+        return;
+
+    // Use whichever representation is smaller.
+    std::size_t const bitset_words = bitset_size<>(vars.back() + 1);
+    if(vars.size() * sizeof(unsigned) <= bitset_words * sizeof(bitset_uint_t))
+        m_vars = vars;
+    else
+    {
+        m_bits.resize(bitset_words);
+        for(unsigned var : vars)
+            bitset_set(m_bits.data(), var);
+    }
+}
+
+gvar_set_t const& gvar_set_t::intern(std::vector<unsigned>& vars)
+{
+    std::sort(vars.begin(), vars.end());
+    vars.erase(std::unique(vars.begin(), vars.end()), vars.end());
+
+    if(vars.empty())
+        return empty_set();
+
+    std::uint32_t const hash = hash_vars(vars);
+    return gvar_set_pool->emplace(hash,
+        [&](gvar_set_t const& set) -> bool
+        {
+            return set.hash() == hash && set.equals(vars);
+        },
+        hash, vars);
+}
+
+gvar_set_t const& gvar_set_t::empty_set()
+{
+    // Kept out of the pool, so that it outlives every 'collect'.
+    static gvar_set_t const set(hash_vars({}), {});
+    return set;
+}
+
+void gvar_set_t::collect(std::vector<gvar_set_t const**> const& refs)
+{
+    // Sets never move, so the kept ones are copied into a new pool.
+    auto pool = std::make_unique<gvar_set_pool_t>();
+    for(gvar_set_t const** ref : refs)
+    {
+        gvar_set_t const& set = **ref;
+        if(&set == &empty_set())
+            continue;
+        *ref = &pool->emplace(set.hash(),
+            [&set](gvar_set_t const& copy) -> bool
+            {
+                return (copy.hash() == set.hash()
+                        && copy.m_vars == set.m_vars
+                        && copy.m_bits == set.m_bits);
+            },
+            set);
+    }
+    gvar_set_pool = std::move(pool);
+}
+
+std::size_t gvar_set_t::pool_memory_size()
+{
+    std::size_t size = gvar_set_pool->memory_size();
+    gvar_set_pool->for_each([&size](gvar_set_t const& set)
+    {
+        size += set.m_vars.capacity() * sizeof(unsigned)
+                + set.m_bits.capacity() * sizeof(bitset_uint_t);
+    });
+    return size;
+}
+
+bool gvar_set_t::count(unsigned var) const
+{
+    if(dense())
+        return var < m_bits.size() * sizeof_bits<bitset_uint_t>
+               && bitset_test(m_bits.data(), var);
+    return std::binary_search(m_vars.begin(), m_vars.end(), var);
+}
+
+void gvar_set_t::append_to(std::vector<unsigned>& vars) const
+{
+    if(dense())
+        for_each([&vars](unsigned var) { vars.push_back(var); });
+    else
+        vars.insert(vars.end(), m_vars.begin(), m_vars.end());
+}
+
+void gvar_set_t::or_into(std::size_t bitset_size, bitset_uint_t* bitset) const
+{
+    if(dense())
+    {
+        assert(m_bits.size() <= bitset_size);
+        bitset_or(m_bits.size(), bitset, m_bits.data());
+    }
+    else for(unsigned var : m_vars)
+    {
+        assert(var < bitset_size * sizeof_bits<bitset_uint_t>);
+        bitset_set(bitset, var);
+    }
+}
+
+bool gvar_set_t::equals(std::vector<unsigned> const& sorted) const
+{
+    if(sorted.size() != m_size)
+        return false;
+    if(dense())
+        return std::all_of(sorted.begin(), sorted.end(),
+                           [this](unsigned var) { return count(var); });
+    return std::equal(sorted.begin(), sorted.end(), m_vars.begin());
+}
@@ -0,0 +1,74 @@
+#ifndef GVAR_SET_HPP
+#define GVAR_SET_HPP
+
+// Immutable sets of global vars, used to summarize which vars
+// a fn reads and writes.
+//
+// Most fns only touch a few vars out of thousands, so small sets are
+// stored as sorted arrays of var indices, and only large sets as bitsets.
+// Sets are interned, so fns with identical summaries share them,
+// and equal sets compare equal by address.
+// Interned sets aren't freed one at a time. Instead, 'collect' drops
+// every set no longer used, between builds.
+
+#include <cstdint>
+#include <vector>
+
+#include "bitset.hpp"
+
+class gvar_set_t
+{
+public:
+    // Returns the set holding 'vars'.
+    // This sorts 'vars' and removes its duplicates.
+    // This function is thread-safe.
+    static gvar_set_t const& intern(std::vector<unsigned>& vars);
+
+    // This is never freed by 'collect'.
+    static gvar_set_t const& empty_set();
+
+    // Frees every set except those pointed to by 'refs', which get
+    // pointed to their new copies. Other references are left dangling.
+    // This function isn't thread-safe.
+    static void collect(std::vector<gvar_set_t const**> const& refs);
+
+    // The bytes held by the interned sets, roughly.
+    static std::size_t pool_memory_size();
+
+    // Use 'intern' instead.
+    gvar_set_t(std::uint32_t hash, std::vector<unsigned> const& vars);
+
+    std::uint32_t hash() const { return m_hash; }
+    std::size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+    bool dense() const { return !m_bits.empty(); }
+
+    bool count(unsigned var) const;
+
+    // Calls 'fn(var)' on each var, in increasing order.
+    template<typename Fn>
+    void for_each(Fn fn) const
+    {
+        if(dense())
+            bitset_for_each(m_bits.size(), m_bits.data(), fn);
+        else for(unsigned var : m_vars)
+            fn(var);
+    }
+
+    // Appends the vars onto 'vars', in increasing order.
+    void append_to(std::vector<unsigned>& vars) const;
+
+    // ORs the set into 'bitset', which must be large enough to hold it.
+    void or_into(std::size_t bitset_size, bitset_uint_t* bitset) const;
+
+    // True if this holds the same vars as 'sorted'.
+    bool equals(std::vector<unsigned> const& sorted) const;
+
+private:
+    std::uint32_t m_hash;
+    unsigned m_size;
+    std::vector<unsigned> m_vars;      // When sparse.
+    std::vector<bitset_uint_t> m_bits; // When dense.
+};
+
+#endif
@@ -0,0 +1,66 @@
+#include "catch/catch.hpp"
+#include "gvar_set.hpp"
+
+TEST_CASE("gvar_set_intern", "[gvar_set]")
+{
+    std::vector<unsigned> a = { 5, 1, 5, 300 };
+    std::vector<unsigned> b = { 300, 1, 5 };
+    gvar_set_t const& set_a = gvar_set_t::intern(a);
+    gvar_set_t const& set_b = gvar_set_t::intern(b);
+
+    REQUIRE(&set_a == &set_b);
+    REQUIRE(set_a.size() == 3);
+    REQUIRE(!set_a.dense());
+    REQUIRE(set_a.count(300));
+    REQUIRE(!set_a.count(4));
+
+    std::vector<unsigned> none;
+    REQUIRE(&gvar_set_t::intern(none) == &gvar_set_t::empty_set());
+    REQUIRE(gvar_set_t::empty_set().empty());
+}
+
+TEST_CASE("gvar_set_dense", "[gvar_set]")
+{
+    std::vector<unsigned> vars;
+    for(unsigned i = 0; i < 200; i += 2)
+        vars.push_back(i);
+    gvar_set_t const& set = gvar_set_t::intern(vars);
+
+    REQUIRE(set.dense());
+    REQUIRE(set.size() == 100);
+    REQUIRE(set.count(198));
+    REQUIRE(!set.count(199));
+    REQUIRE(!set.count(100000));
+
+    std::vector<unsigned> out;
+    set.append_to(out);
+    REQUIRE(out == vars);
+
+    bitset_uint_t bitset[4] = {};
+    set.or_into(4, bitset);
+    REQUIRE(bitset[0] == 0x5555555555555555ull);
+    REQUIRE(bitset[3] == 0x55ull);
+}
+
+TEST_CASE("gvar_set_collect", "[gvar_set]")
+{
+    std::vector<unsigned> a = { 1, 2, 3 };
+    std::vector<unsigned> b = { 4, 5 };
+    gvar_set_t const* kept = &gvar_set_t::intern(a);
+    gvar_set_t const* shared = kept;
+    gvar_set_t const* empty = &gvar_set_t::empty_set();
+    gvar_set_t::intern(b);
+
+    // Both references to the kept set end up at the same copy.
+    gvar_set_t::collect({ &kept, &shared, &empty });
+    REQUIRE(kept == shared);
+    REQUIRE(empty == &gvar_set_t::empty_set());
+    REQUIRE(kept->size() == 3);
+    REQUIRE(kept->count(2));
+
+    // The copy is what gets interned from now on.
+    std::vector<unsigned> a2 = { 3, 2, 1 };
+    REQUIRE(&gvar_set_t::intern(a2) == kept);
+    std::vector<unsigned> b2 = { 4, 5 };
+    REQUIRE(gvar_set_t::intern(b2).size() == 2);
+}
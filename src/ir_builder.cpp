@@ -100,8 +100,8 @@ private:
     [[gnu::noreturn]] 
     void compiler_error(pstring_t pstring, std::string const& what) const
     { 
-        // The parsed file was already deleted,
-        // so reload it just for this error:
+        // Files stay resident for the whole compile,
+        // so this doesn't touch the disk again:
         file_contents_t file(pstring.file_i);
         ::compiler_error(file, pstring, what); 
     }
@@ -487,8 +487,6 @@ ssa_ht ir_builder_t::insert_fn_call(cfg_ht cfg_node,
                                     global_t const& fn_global,
                                     rpn_value_t const* args)
 {
-    unsigned const set_size = bitset_size<>(global_t::num_vars());
-
     bc::small_vector<ssa_value_t, 32> fn_inputs;
 
     // The [0] argument holds the fn_t ptr.
@@ -499,7 +497,7 @@ ssa_ht ir_builder_t::insert_fn_call(cfg_ht cfg_node,
     auto* seen = ALLOCA_T(bitset_uint_t, seen_bitset_size);
     bitset_clear_all(seen_bitset_size, seen);
 
-    bitset_for_each(set_size, fn_global.fn().reads(),
+    fn_global.fn().reads().for_each(
     [this, cfg_node, seen, &fn_inputs](unsigned bit)
     {
         global_t& var = global_t::get_var({ bit });
@@ -532,7 +530,7 @@ ssa_ht ir_builder_t::insert_fn_call(cfg_ht cfg_node,
 
     bitset_clear_all(seen_bitset_size, seen);
 
-    bitset_for_each(set_size, fn_global.fn().writes(),
+    fn_global.fn().writes().for_each(
     [this, cfg_node, seen, ret](unsigned bit)
     {
         global_t& var = global_t::get_var({ bit });
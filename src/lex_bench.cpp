@@ -0,0 +1,174 @@
+// Measures lexing throughput on a large generated corpus,
+// comparing the byte-at-a-time DFA against the run-skipping lexer.
+//
+// Usage: lex_bench [corpus megabytes] [repetitions]
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "lexer.hpp"
+
+namespace
+{
+    // Deterministic, so that runs are comparable.
+    struct rng_t
+    {
+        std::uint64_t state = 0x853c49e6748fea9bull;
+
+        unsigned operator()(unsigned n)
+        {
+            state = state * 6364136223846793005ull + 1442695040888963407ull;
+            return (state >> 33) % n;
+        }
+    };
+
+    std::string gen_ident(rng_t& rng)
+    {
+        static char const first[] = "abcdefghijklmnopqrstuvwxyz";
+        static char const rest[] =
+            "abcdefghijklmnopqrstuvwxyz_0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+        std::string str(1, first[rng(26)]);
+        unsigned const size = 2 + rng(16);
+        for(unsigned i = 0; i < size; ++i)
+            str.push_back(rest[rng(sizeof(rest) - 1)]);
+        return str;
+    }
+
+    std::string gen_expr(rng_t& rng, unsigned depth = 0)
+    {
+        static char const* const ops[] =
+            { " + ", " - ", " & ", " | ", " ^ ", " << ", " == ", " < " };
+        std::string str;
+        switch(depth < 3 ? rng(4) : rng(2))
+        {
+        case 0: return gen_ident(rng);
+        case 1: return std::to_string(rng(100000));
+        case 2:
+            return gen_expr(rng, depth+1) + ops[rng(8)]
+                   + gen_expr(rng, depth+1);
+        default:
+            return gen_ident(rng) + "(" + gen_expr(rng, depth+1) + ", "
+                   + gen_expr(rng, depth+1) + ")";
+        }
+    }
+
+    // Generates MOSBOL-like source text.
+    // It doesn't need to parse, but it does need to lex.
+    std::string gen_corpus(std::size_t bytes)
+    {
+        rng_t rng;
+        std::string str;
+        while(str.size() < bytes)
+        {
+            str += "// " + std::string(20 + rng(60), 'x') + " comment\n";
+            str += "fn " + gen_ident(rng) + "(byte a, short b) fixed12\n";
+            unsigned const lines = 4 + rng(30);
+            for(unsigned i = 0; i < lines; ++i)
+            {
+                std::string const indent((1 + rng(4)) * 4, ' ');
+                switch(rng(5))
+                {
+                case 0:
+                    str += indent + "// " + gen_ident(rng) + " "
+                           + gen_ident(rng) + " " + gen_ident(rng) + "\n";
+                    break;
+                case 1:
+                    str += indent + "if " + gen_expr(rng) + "\n";
+                    break;
+                case 2:
+                    str += indent + "short " + gen_ident(rng) + " = "
+                           + gen_expr(rng) + "\n";
+                    break;
+                default:
+                    str += indent + gen_ident(rng) + " = "
+                           + gen_expr(rng) + "\n";
+                    break;
+                }
+            }
+            str += "\n";
+        }
+        return str;
+    }
+
+    // Lexes everything, line by line like the parser does.
+    // Returns a checksum of the token stream.
+    template<bool Fast>
+    std::uint64_t lex_all(char const* source, std::size_t& num_tokens)
+    {
+        std::uint64_t checksum = 0;
+        char const* next_char = source;
+        while(true)
+        {
+            if(Fast)
+                next_char = lex_skip(RUN_INDENT, next_char);
+            else while(*next_char == ' ')
+                ++next_char;
+
+            while(true)
+            {
+                char const* const token_source = next_char;
+                token_type_t const type = lex_token<Fast>(next_char);
+                checksum = checksum * 31 + type * 1009
+                           + (next_char - token_source);
+                ++num_tokens;
+
+                if(type == TOK_ERROR)
+                {
+                    std::fprintf(stderr, "Invalid token at %zu.\n",
+                                 (std::size_t)(token_source - source));
+                    std::exit(EXIT_FAILURE);
+                }
+                if(type == TOK_eof)
+                    return checksum;
+                if(type == TOK_eol || type == TOK_comment)
+                    break;
+            }
+        }
+    }
+
+    template<bool Fast>
+    void bench(char const* name, std::string const& corpus, unsigned reps,
+               std::uint64_t& checksum)
+    {
+        double best = 1e30;
+        std::size_t num_tokens = 0;
+        for(unsigned i = 0; i < reps; ++i)
+        {
+            num_tokens = 0;
+            auto const start = std::chrono::steady_clock::now();
+            checksum = lex_all<Fast>(corpus.c_str(), num_tokens);
+            auto const end = std::chrono::steady_clock::now();
+            best = std::min(best,
+                std::chrono::duration<double>(end - start).count());
+        }
+
+        double const mb = corpus.size() / (1024.0 * 1024.0);
+        std::printf("%-8s %8.1f MB/s %8.1f Mtokens/s\n", name, mb / best,
+                    num_tokens / best / 1e6);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t const megabytes = argc > 1 ? std::atoi(argv[1]) : 64;
+    unsigned const reps = argc > 2 ? std::atoi(argv[2]) : 5;
+
+    std::string const corpus = gen_corpus(megabytes * 1024 * 1024);
+    std::printf("corpus: %zu bytes, scanner: %s\n", corpus.size(),
+                lex_skip_impl_name());
+
+    std::uint64_t dfa_checksum, fast_checksum;
+    bench<false>("dfa", corpus, reps, dfa_checksum);
+    bench<true>("skip", corpus, reps, fast_checksum);
+
+    if(dfa_checksum != fast_checksum)
+    {
+        std::fprintf(stderr, "Token streams differ!\n");
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
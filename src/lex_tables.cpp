@@ -1,632 +1,634 @@
 #include "lex_tables.hpp"
-extern unsigned const lexer_ec_table[256] = {
-    0, 199, 199, 199, 199, 199, 199, 199, 199, 398, 597, 199, 199, 796, 199, 199,
-    199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199,
-    398, 995, 199, 199, 199, 1194, 1393, 199, 1592, 1791, 1990, 2189, 2388, 2587, 199, 2786,
-    2985, 2985, 2985, 2985, 2985, 2985, 2985, 2985, 2985, 2985, 199, 3184, 3383, 3582, 3781, 199,
-    199, 3980, 3980, 3980, 3980, 3980, 3980, 3980, 3980, 3980, 3980, 3980, 3980, 3980, 3980, 3980,
-    3980, 3980, 3980, 3980, 3980, 3980, 3980, 3980, 3980, 3980, 3980, 199, 199, 199, 4179, 3980,
-    199, 4378, 4577, 4776, 4975, 5174, 5373, 5572, 5771, 5970, 6169, 6368, 6567, 6169, 6766, 6965,
-    6169, 6169, 7164, 7363, 7562, 7761, 7960, 8159, 8358, 8557, 6169, 8756, 8955, 9154, 9353, 199,
-    9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552,
-    9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552,
-    9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552,
-    9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552,
-    9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552,
-    9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552,
-    9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552,
-    9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552, 9552,
+extern std::uint16_t const lexer_ec_table[256] = {
+    0, 200, 200, 200, 200, 200, 200, 200, 200, 400, 600, 200, 200, 800, 200, 200,
+    200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200,
+    400, 1000, 200, 200, 200, 1200, 1400, 200, 1600, 1800, 2000, 2200, 2400, 2600, 200, 2800,
+    3000, 3000, 3000, 3000, 3000, 3000, 3000, 3000, 3000, 3000, 200, 3200, 3400, 3600, 3800, 200,
+    200, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000,
+    4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 200, 200, 200, 4200, 4000,
+    200, 4400, 4600, 4800, 5000, 5200, 5400, 5600, 5800, 6000, 6200, 6400, 6600, 6200, 6800, 7000,
+    6200, 6200, 7200, 7400, 7600, 7800, 8000, 8200, 8400, 8600, 6200, 8800, 9000, 9200, 9400, 200,
+    9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600,
+    9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600,
+    9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600,
+    9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600,
+    9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600,
+    9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600,
+    9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600,
+    9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600, 9600,
 };
-extern token_type_t const lexer_transition_table[9751] = {
-
+extern lexer_state_t const lexer_transition_table[9800] = {
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 73, 1, 62, 68, 68, 68, 4, 3,
+    0, 0, 0, 0, 0, 0, 0, 0, 75, 52, 197, 1, 68, 68, 4, 3,
     3, 45, 22, 31, 25, 61, 0, 27, 24, 28, 0, 69, 23, 34, 48, 36,
     32, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 18,
-    33, 19, 44, 57, 55, 42, 56, 52, 68, 68, 8, 68, 68, 68, 68, 68,
-    68, 68, 13, 68, 68, 68, 16, 5, 68, 66, 68, 68, 15, 68, 14, 68,
-    7, 68, 68, 68, 68, 68, 67, 68, 68, 6, 9, 68, 68, 68, 68, 68,
-    11, 68, 68, 68, 68, 68, 68, 68, 10, 68, 63, 64, 58, 37, 30, 60,
-    38, 29, 35, 59, 181, 2, 2, 47, 50, 46, 49, 51, 40, 53, 54, 39,
-    3, 68, 68, 68, 12, 17, 65, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    33, 19, 44, 57, 55, 42, 56, 47, 50, 68, 68, 68, 8, 68, 68, 12,
+    68, 68, 68, 65, 68, 68, 68, 68, 13, 68, 68, 68, 16, 5, 68, 66,
+    68, 68, 15, 68, 14, 68, 7, 68, 68, 68, 68, 67, 68, 68, 6, 9,
+    68, 68, 68, 68, 68, 68, 11, 68, 68, 68, 68, 64, 68, 68, 10, 68,
+    63, 58, 37, 30, 60, 38, 29, 35, 59, 46, 49, 51, 40, 53, 54, 39,
+    3, 68, 62, 68, 17, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    1, 62, 68, 68, 68, 4, 3, 3, 45, 22, 31, 25, 61, 0, 27, 24,
-    28, 0, 69, 23, 34, 48, 36, 32, 68, 68, 68, 68, 68, 68, 68, 68,
-    68, 68, 68, 68, 68, 68, 18, 33, 19, 44, 57, 55, 42, 56, 52, 68,
-    68, 8, 68, 68, 68, 68, 68, 68, 68, 13, 68, 68, 68, 16, 5, 68,
-    66, 68, 68, 15, 68, 14, 68, 7, 68, 68, 68, 68, 68, 67, 68, 68,
-    6, 9, 68, 68, 68, 68, 68, 11, 68, 68, 68, 68, 68, 68, 68, 10,
-    68, 63, 64, 58, 37, 30, 60, 38, 29, 35, 59, 180, 2, 2, 47, 50,
-    46, 49, 51, 40, 53, 54, 39, 3, 68, 68, 68, 12, 17, 65, 0, 0,
+    0, 52, 74, 1, 68, 68, 4, 3, 3, 45, 22, 31, 25, 61, 0, 27,
+    24, 28, 0, 69, 23, 34, 48, 36, 32, 68, 68, 68, 68, 68, 68, 68,
+    68, 68, 68, 68, 68, 68, 68, 18, 33, 19, 44, 57, 55, 42, 56, 47,
+    50, 68, 68, 68, 8, 68, 68, 12, 68, 68, 68, 65, 68, 68, 68, 68,
+    13, 68, 68, 68, 16, 5, 68, 66, 68, 68, 15, 68, 14, 68, 7, 68,
+    68, 68, 68, 67, 68, 68, 6, 9, 68, 68, 68, 68, 68, 68, 11, 68,
+    68, 68, 68, 64, 68, 68, 10, 68, 63, 58, 37, 30, 60, 38, 29, 35,
+    59, 46, 49, 51, 40, 53, 54, 39, 3, 68, 62, 68, 17, 2, 2, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 78, 52, 74, 1, 68, 68, 78, 3,
+    3, 45, 22, 31, 25, 61, 0, 27, 24, 28, 0, 69, 23, 34, 48, 36,
+    32, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 18,
+    33, 19, 44, 57, 55, 42, 56, 47, 50, 68, 68, 68, 8, 68, 68, 12,
+    68, 68, 68, 65, 68, 68, 68, 68, 13, 68, 68, 68, 16, 5, 68, 66,
+    68, 68, 15, 68, 14, 68, 7, 68, 68, 68, 68, 67, 68, 68, 6, 9,
+    68, 68, 68, 68, 68, 68, 11, 68, 68, 68, 68, 64, 68, 68, 10, 68,
+    63, 58, 37, 30, 60, 38, 29, 35, 59, 46, 49, 51, 40, 53, 54, 39,
+    3, 68, 62, 68, 17, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 78, 1, 62, 68, 68, 68, 78, 3, 3, 45,
-    22, 31, 25, 61, 0, 27, 24, 28, 0, 69, 23, 34, 48, 36, 32, 68,
-    68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 18, 33, 19,
-    44, 57, 55, 42, 56, 52, 68, 68, 8, 68, 68, 68, 68, 68, 68, 68,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    79, 52, 198, 1, 68, 68, 4, 3, 192, 45, 22, 31, 25, 61, 0, 27,
+    24, 28, 0, 69, 23, 34, 48, 36, 32, 68, 68, 68, 68, 68, 68, 68,
+    68, 68, 68, 68, 68, 68, 68, 18, 33, 19, 44, 57, 55, 42, 56, 47,
+    50, 68, 68, 68, 8, 68, 68, 12, 68, 68, 68, 65, 68, 68, 68, 68,
     13, 68, 68, 68, 16, 5, 68, 66, 68, 68, 15, 68, 14, 68, 7, 68,
-    68, 68, 68, 68, 67, 68, 68, 6, 9, 68, 68, 68, 68, 68, 11, 68,
-    68, 68, 68, 68, 68, 68, 10, 68, 63, 64, 58, 37, 30, 60, 38, 29,
-    35, 59, 180, 2, 2, 47, 50, 46, 49, 51, 40, 53, 54, 39, 3, 68,
-    68, 68, 12, 17, 65, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    68, 68, 68, 67, 68, 68, 6, 9, 68, 68, 68, 68, 68, 68, 11, 68,
+    68, 68, 68, 64, 68, 68, 10, 68, 63, 58, 37, 30, 60, 38, 29, 35,
+    59, 46, 49, 51, 40, 53, 54, 39, 3, 68, 62, 68, 17, 2, 2, 197,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 79, 1, 62,
-    68, 68, 68, 4, 3, 192, 45, 22, 31, 25, 61, 0, 27, 24, 28, 0,
-    69, 23, 34, 48, 36, 32, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
-    68, 68, 68, 68, 18, 33, 19, 44, 57, 55, 42, 56, 52, 68, 68, 8,
-    68, 68, 68, 68, 68, 68, 68, 13, 68, 68, 68, 16, 5, 68, 66, 68,
-    68, 15, 68, 14, 68, 7, 68, 68, 68, 68, 68, 67, 68, 68, 6, 9,
-    68, 68, 68, 68, 68, 11, 68, 68, 68, 68, 68, 68, 68, 10, 68, 63,
-    64, 58, 37, 30, 60, 38, 29, 35, 59, 182, 2, 2, 47, 50, 46, 49,
-    51, 40, 53, 54, 39, 3, 68, 68, 68, 12, 17, 65, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 80, 52, 199, 1, 68, 68, 4, 192,
+    3, 45, 22, 31, 25, 61, 0, 27, 24, 28, 0, 69, 23, 34, 48, 36,
+    32, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 18,
+    33, 19, 44, 57, 55, 42, 56, 47, 50, 68, 68, 68, 8, 68, 68, 12,
+    68, 68, 68, 65, 68, 68, 68, 68, 13, 68, 68, 68, 16, 5, 68, 66,
+    68, 68, 15, 68, 14, 68, 7, 68, 68, 68, 68, 67, 68, 68, 6, 9,
+    68, 68, 68, 68, 68, 68, 11, 68, 68, 68, 68, 64, 68, 68, 10, 68,
+    63, 58, 37, 30, 60, 38, 29, 35, 59, 46, 49, 51, 40, 53, 54, 39,
+    3, 68, 62, 68, 17, 2, 197, 2, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 80, 1, 62, 68, 68, 68, 4, 192, 3, 45, 22, 31,
-    25, 61, 0, 27, 24, 28, 0, 69, 23, 34, 48, 36, 32, 68, 68, 68,
-    68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 18, 33, 19, 44, 57,
-    55, 42, 56, 52, 68, 68, 8, 68, 68, 68, 68, 68, 68, 68, 13, 68,
-    68, 68, 16, 5, 68, 66, 68, 68, 15, 68, 14, 68, 7, 68, 68, 68,
-    68, 68, 67, 68, 68, 6, 9, 68, 68, 68, 68, 68, 11, 68, 68, 68,
-    68, 68, 68, 68, 10, 68, 63, 64, 58, 37, 30, 60, 38, 29, 35, 59,
-    180, 2, 181, 47, 50, 46, 49, 51, 40, 53, 54, 39, 3, 68, 68, 68,
-    12, 17, 65, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    81, 52, 74, 1, 68, 68, 4, 3, 3, 45, 22, 31, 25, 61, 0, 27,
+    24, 28, 0, 69, 23, 34, 48, 36, 32, 68, 68, 68, 68, 68, 68, 68,
+    68, 68, 68, 68, 68, 68, 68, 18, 33, 19, 44, 57, 55, 42, 56, 47,
+    50, 68, 68, 68, 8, 68, 68, 12, 68, 68, 68, 65, 68, 68, 68, 68,
+    13, 68, 68, 68, 16, 5, 68, 66, 68, 68, 15, 68, 14, 68, 7, 68,
+    68, 68, 68, 67, 68, 68, 6, 9, 68, 68, 68, 68, 68, 68, 11, 68,
+    68, 68, 68, 64, 68, 68, 10, 68, 63, 58, 37, 30, 60, 38, 29, 35,
+    59, 46, 49, 51, 40, 53, 54, 39, 3, 68, 62, 68, 17, 2, 2, 2,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 81, 1, 62, 68, 68,
-    68, 4, 3, 3, 45, 22, 31, 25, 61, 0, 27, 24, 28, 0, 69, 23,
-    34, 48, 36, 32, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
-    68, 68, 18, 33, 19, 44, 57, 55, 42, 56, 52, 68, 68, 8, 68, 68,
-    68, 68, 68, 68, 68, 13, 68, 68, 68, 16, 5, 68, 66, 68, 68, 15,
-    68, 14, 68, 7, 68, 68, 68, 68, 68, 67, 68, 68, 6, 9, 68, 68,
-    68, 68, 68, 11, 68, 68, 68, 68, 68, 68, 68, 10, 68, 63, 64, 58,
-    37, 30, 60, 38, 29, 35, 59, 180, 2, 2, 47, 50, 46, 49, 51, 40,
-    53, 54, 39, 3, 68, 68, 68, 12, 17, 65, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 82, 52, 74, 1, 68, 68, 4, 3,
+    3, 45, 22, 31, 25, 61, 0, 27, 24, 28, 0, 69, 23, 34, 48, 36,
+    32, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 18,
+    33, 19, 44, 57, 55, 42, 56, 47, 50, 68, 68, 68, 8, 68, 68, 12,
+    68, 68, 68, 65, 68, 68, 68, 68, 13, 68, 68, 68, 16, 5, 68, 66,
+    68, 68, 15, 68, 14, 68, 7, 68, 68, 68, 68, 67, 68, 68, 6, 9,
+    68, 68, 68, 68, 68, 68, 11, 68, 68, 68, 68, 64, 68, 68, 10, 68,
+    63, 58, 37, 30, 60, 38, 29, 35, 59, 46, 49, 51, 40, 53, 54, 39,
+    3, 68, 62, 68, 17, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 82, 1, 62, 68, 68, 68, 4, 3, 3, 45, 22, 31, 25, 61,
-    0, 27, 24, 28, 0, 69, 23, 34, 48, 36, 32, 68, 68, 68, 68, 68,
-    68, 68, 68, 68, 68, 68, 68, 68, 68, 18, 33, 19, 44, 57, 55, 42,
-    56, 52, 68, 68, 8, 68, 68, 68, 68, 68, 68, 68, 13, 68, 68, 68,
-    16, 5, 68, 66, 68, 68, 15, 68, 14, 68, 7, 68, 68, 68, 68, 68,
-    67, 68, 68, 6, 9, 68, 68, 68, 68, 68, 11, 68, 68, 68, 68, 68,
-    68, 68, 10, 68, 63, 64, 58, 37, 30, 60, 38, 29, 35, 59, 180, 2,
-    2, 47, 50, 46, 49, 51, 40, 53, 54, 39, 3, 68, 68, 68, 12, 17,
-    65, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    83, 52, 74, 1, 68, 68, 4, 3, 3, 45, 22, 188, 25, 61, 0, 27,
+    24, 28, 0, 69, 23, 34, 48, 36, 32, 68, 68, 68, 68, 68, 68, 68,
+    68, 68, 68, 68, 68, 68, 68, 18, 33, 19, 44, 57, 55, 42, 56, 47,
+    50, 68, 68, 68, 8, 68, 68, 12, 68, 68, 68, 65, 68, 68, 68, 68,
+    13, 68, 68, 68, 16, 5, 68, 66, 68, 68, 15, 68, 14, 68, 7, 68,
+    68, 68, 68, 67, 68, 68, 6, 9, 68, 68, 68, 68, 68, 68, 11, 68,
+    68, 68, 68, 64, 68, 68, 10, 68, 63, 58, 37, 30, 60, 38, 29, 35,
+    59, 46, 49, 51, 40, 53, 54, 39, 3, 68, 62, 68, 17, 2, 2, 2,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 83, 1, 62, 68, 68, 68, 4,
-    3, 3, 45, 22, 188, 25, 61, 0, 27, 24, 28, 0, 69, 23, 34, 48,
-    36, 32, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
-    18, 33, 19, 44, 57, 55, 42, 56, 52, 68, 68, 8, 68, 68, 68, 68,
-    68, 68, 68, 13, 68, 68, 68, 16, 5, 68, 66, 68, 68, 15, 68, 14,
-    68, 7, 68, 68, 68, 68, 68, 67, 68, 68, 6, 9, 68, 68, 68, 68,
-    68, 11, 68, 68, 68, 68, 68, 68, 68, 10, 68, 63, 64, 58, 37, 30,
-    60, 38, 29, 35, 59, 180, 2, 2, 47, 50, 46, 49, 51, 40, 53, 54,
-    39, 3, 68, 68, 68, 12, 17, 65, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 84, 52, 74, 1, 68, 68, 4, 3,
+    3, 45, 22, 31, 25, 61, 0, 27, 24, 28, 0, 69, 23, 34, 48, 36,
+    32, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 18,
+    33, 19, 44, 57, 55, 42, 56, 47, 50, 68, 68, 68, 8, 68, 68, 12,
+    68, 68, 68, 65, 68, 68, 68, 68, 13, 68, 68, 68, 16, 5, 68, 66,
+    68, 68, 15, 68, 14, 68, 7, 68, 68, 68, 68, 67, 68, 68, 6, 9,
+    68, 68, 68, 68, 68, 68, 11, 68, 68, 68, 68, 64, 68, 68, 10, 68,
+    63, 58, 37, 30, 60, 38, 29, 35, 59, 46, 49, 51, 40, 53, 54, 39,
+    3, 68, 62, 68, 17, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    84, 1, 62, 68, 68, 68, 4, 3, 3, 45, 22, 31, 25, 61, 0, 27,
-    24, 28, 0, 69, 23, 34, 48, 36, 32, 68, 68, 68, 68, 68, 68, 68,
-    68, 68, 68, 68, 68, 68, 68, 18, 33, 19, 44, 57, 55, 42, 56, 52,
-    68, 68, 8, 68, 68, 68, 68, 68, 68, 68, 13, 68, 68, 68, 16, 5,
-    68, 66, 68, 68, 15, 68, 14, 68, 7, 68, 68, 68, 68, 68, 67, 68,
-    68, 6, 9, 68, 68, 68, 68, 68, 11, 68, 68, 68, 68, 68, 68, 68,
-    10, 68, 63, 64, 58, 37, 30, 60, 38, 29, 35, 59, 180, 2, 2, 47,
-    50, 46, 49, 51, 40, 53, 54, 39, 3, 68, 68, 68, 12, 17, 65, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    85, 52, 74, 1, 68, 68, 4, 3, 3, 45, 22, 31, 25, 61, 0, 27,
+    24, 28, 0, 69, 23, 34, 48, 36, 32, 68, 68, 68, 68, 68, 68, 68,
+    68, 68, 68, 68, 68, 68, 68, 18, 33, 19, 44, 57, 55, 42, 56, 47,
+    50, 68, 68, 68, 8, 68, 68, 12, 68, 68, 68, 65, 68, 68, 68, 68,
+    13, 68, 68, 68, 16, 5, 68, 66, 68, 68, 15, 68, 14, 68, 7, 68,
+    68, 68, 68, 67, 68, 68, 6, 9, 68, 68, 68, 68, 68, 68, 11, 68,
+    68, 68, 68, 64, 68, 68, 10, 68, 63, 58, 37, 30, 60, 38, 29, 35,
+    59, 46, 49, 51, 40, 53, 54, 39, 3, 68, 62, 68, 17, 2, 2, 2,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 85, 1, 62, 68, 68, 68, 4, 3, 3,
-    45, 22, 31, 25, 61, 0, 27, 24, 28, 0, 69, 23, 34, 48, 36, 32,
-    68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 18, 33,
-    19, 44, 57, 55, 42, 56, 52, 68, 68, 8, 68, 68, 68, 68, 68, 68,
-    68, 13, 68, 68, 68, 16, 5, 68, 66, 68, 68, 15, 68, 14, 68, 7,
-    68, 68, 68, 68, 68, 67, 68, 68, 6, 9, 68, 68, 68, 68, 68, 11,
-    68, 68, 68, 68, 68, 68, 68, 10, 68, 63, 64, 58, 37, 30, 60, 38,
-    29, 35, 59, 180, 2, 2, 47, 50, 46, 49, 51, 40, 53, 54, 39, 3,
-    68, 68, 68, 12, 17, 65, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 86, 1,
-    62, 68, 68, 68, 4, 3, 3, 45, 22, 31, 25, 61, 0, 27, 24, 28,
-    0, 69, 23, 34, 48, 36, 32, 68, 68, 68, 68, 68, 68, 68, 68, 68,
-    68, 68, 68, 68, 68, 18, 33, 19, 44, 57, 55, 42, 56, 52, 68, 68,
-    8, 68, 68, 68, 68, 68, 68, 68, 13, 68, 68, 68, 16, 5, 68, 66,
-    68, 68, 15, 68, 14, 68, 7, 68, 68, 68, 68, 68, 67, 68, 68, 6,
-    9, 68, 68, 68, 68, 68, 11, 68, 68, 68, 68, 68, 68, 68, 10, 68,
-    63, 64, 58, 37, 30, 60, 38, 29, 35, 59, 180, 2, 2, 47, 50, 46,
-    49, 51, 40, 53, 54, 39, 3, 68, 68, 68, 12, 17, 65, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 86, 52, 74, 1, 68, 68, 4, 3,
+    3, 45, 22, 31, 25, 61, 0, 27, 24, 28, 0, 69, 23, 34, 48, 36,
+    32, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 18,
+    33, 19, 44, 57, 55, 42, 56, 47, 50, 68, 68, 68, 8, 68, 68, 12,
+    68, 68, 68, 65, 68, 68, 68, 68, 13, 68, 68, 68, 16, 5, 68, 66,
+    68, 68, 15, 68, 14, 68, 7, 68, 68, 68, 68, 67, 68, 68, 6, 9,
+    68, 68, 68, 68, 68, 68, 11, 68, 68, 68, 68, 64, 68, 68, 10, 68,
+    63, 58, 37, 30, 60, 38, 29, 35, 59, 46, 49, 51, 40, 53, 54, 39,
+    3, 68, 62, 68, 17, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 87, 1, 62, 68, 68, 68, 4, 3, 3, 45, 22,
-    31, 25, 61, 0, 185, 24, 28, 0, 69, 23, 34, 48, 36, 32, 68, 68,
-    68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 18, 33, 19, 44,
-    57, 55, 42, 56, 52, 68, 68, 8, 68, 68, 68, 68, 68, 68, 68, 13,
-    68, 68, 68, 16, 5, 68, 66, 68, 68, 15, 68, 14, 68, 7, 68, 68,
-    68, 68, 68, 67, 68, 68, 6, 9, 68, 68, 68, 68, 68, 11, 68, 68,
-    68, 68, 68, 68, 68, 10, 68, 63, 64, 58, 37, 30, 60, 38, 29, 35,
-    59, 180, 2, 2, 47, 50, 46, 49, 51, 40, 53, 54, 39, 3, 68, 68,
-    68, 12, 17, 65, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    87, 52, 74, 1, 68, 68, 4, 3, 3, 45, 22, 31, 25, 61, 0, 185,
+    24, 28, 0, 69, 23, 34, 48, 36, 32, 68, 68, 68, 68, 68, 68, 68,
+    68, 68, 68, 68, 68, 68, 68, 18, 33, 19, 44, 57, 55, 42, 56, 47,
+    50, 68, 68, 68, 8, 68, 68, 12, 68, 68, 68, 65, 68, 68, 68, 68,
+    13, 68, 68, 68, 16, 5, 68, 66, 68, 68, 15, 68, 14, 68, 7, 68,
+    68, 68, 68, 67, 68, 68, 6, 9, 68, 68, 68, 68, 68, 68, 11, 68,
+    68, 68, 68, 64, 68, 68, 10, 68, 63, 58, 37, 30, 60, 38, 29, 35,
+    59, 46, 49, 51, 40, 53, 54, 39, 3, 68, 62, 68, 17, 2, 2, 2,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 88, 1, 62, 68,
-    68, 68, 4, 3, 3, 45, 22, 31, 25, 61, 0, 27, 24, 28, 0, 69,
-    23, 34, 48, 36, 32, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
-    68, 68, 68, 18, 33, 19, 44, 57, 55, 42, 56, 52, 68, 68, 8, 68,
-    68, 68, 68, 68, 68, 68, 13, 68, 68, 68, 16, 5, 68, 66, 68, 68,
-    15, 68, 14, 68, 7, 68, 68, 68, 68, 68, 67, 68, 68, 6, 9, 68,
-    68, 68, 68, 68, 11, 68, 68, 68, 68, 68, 68, 68, 10, 68, 63, 64,
-    58, 37, 30, 60, 38, 29, 35, 59, 180, 2, 2, 47, 50, 46, 49, 51,
-    40, 53, 54, 39, 3, 68, 68, 68, 12, 17, 65, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 88, 52, 74, 1, 68, 68, 4, 3,
+    3, 45, 22, 31, 25, 61, 0, 27, 24, 28, 0, 69, 23, 34, 48, 36,
+    32, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 18,
+    33, 19, 44, 57, 55, 42, 56, 47, 50, 68, 68, 68, 8, 68, 68, 12,
+    68, 68, 68, 65, 68, 68, 68, 68, 13, 68, 68, 68, 16, 5, 68, 66,
+    68, 68, 15, 68, 14, 68, 7, 68, 68, 68, 68, 67, 68, 68, 6, 9,
+    68, 68, 68, 68, 68, 68, 11, 68, 68, 68, 68, 64, 68, 68, 10, 68,
+    63, 58, 37, 30, 60, 38, 29, 35, 59, 46, 49, 51, 40, 53, 54, 39,
+    3, 68, 62, 68, 17, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 89, 1, 62, 68, 68, 68, 4, 3, 3, 45, 22, 31, 25,
-    61, 0, 27, 24, 183, 0, 69, 23, 34, 48, 36, 32, 68, 68, 68, 68,
-    68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 18, 33, 19, 44, 57, 55,
-    42, 56, 52, 68, 68, 8, 68, 68, 68, 68, 68, 68, 68, 13, 68, 68,
-    68, 16, 5, 68, 66, 68, 68, 15, 68, 14, 68, 7, 68, 68, 68, 68,
-    68, 67, 68, 68, 6, 9, 68, 68, 68, 68, 68, 11, 68, 68, 68, 68,
-    68, 68, 68, 10, 68, 63, 64, 58, 37, 30, 60, 38, 29, 35, 59, 180,
-    2, 2, 47, 50, 46, 49, 51, 40, 53, 54, 39, 3, 68, 68, 68, 12,
-    17, 65, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    89, 52, 74, 1, 68, 68, 4, 3, 3, 45, 22, 31, 25, 61, 0, 27,
+    24, 119, 0, 69, 23, 34, 48, 36, 32, 68, 68, 68, 68, 68, 68, 68,
+    68, 68, 68, 68, 68, 68, 68, 18, 33, 19, 44, 57, 55, 42, 56, 47,
+    50, 68, 68, 68, 8, 68, 68, 12, 68, 68, 68, 65, 68, 68, 68, 68,
+    13, 68, 68, 68, 16, 5, 68, 66, 68, 68, 15, 68, 14, 68, 7, 68,
+    68, 68, 68, 67, 68, 68, 6, 9, 68, 68, 68, 68, 68, 68, 11, 68,
+    68, 68, 68, 64, 68, 68, 10, 68, 63, 58, 37, 30, 60, 38, 29, 35,
+    59, 46, 49, 51, 40, 53, 54, 39, 3, 68, 62, 68, 17, 2, 2, 2,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 90, 1, 62, 68, 68, 68,
-    4, 3, 3, 45, 22, 31, 25, 61, 0, 27, 24, 28, 180, 69, 23, 34,
-    48, 36, 32, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
-    68, 18, 33, 19, 44, 57, 55, 42, 56, 52, 68, 68, 8, 68, 68, 68,
-    68, 68, 68, 68, 13, 68, 68, 68, 16, 5, 68, 66, 68, 68, 15, 68,
-    14, 68, 7, 68, 68, 68, 68, 68, 67, 68, 68, 6, 9, 68, 68, 68,
-    68, 68, 11, 68, 68, 68, 68, 68, 68, 68, 10, 68, 63, 64, 58, 37,
-    30, 60, 38, 29, 35, 59, 180, 2, 2, 47, 50, 46, 49, 51, 40, 53,
-    54, 39, 3, 68, 68, 68, 12, 17, 65, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 90, 52, 74, 1, 68, 68, 4, 3,
+    3, 45, 22, 31, 25, 61, 0, 27, 24, 28, 74, 69, 23, 34, 48, 36,
+    32, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 18,
+    33, 19, 44, 57, 55, 42, 56, 47, 50, 68, 68, 68, 8, 68, 68, 12,
+    68, 68, 68, 65, 68, 68, 68, 68, 13, 68, 68, 68, 16, 5, 68, 66,
+    68, 68, 15, 68, 14, 68, 7, 68, 68, 68, 68, 67, 68, 68, 6, 9,
+    68, 68, 68, 68, 68, 68, 11, 68, 68, 68, 68, 64, 68, 68, 10, 68,
+    63, 58, 37, 30, 60, 38, 29, 35, 59, 46, 49, 51, 40, 53, 54, 39,
+    3, 68, 62, 68, 17, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 91, 1, 97, 97, 97, 97, 4, 3, 3, 45, 22, 31, 25, 61, 0,
-    27, 24, 28, 0, 91, 23, 34, 48, 36, 32, 97, 97, 97, 97, 97, 97,
-    97, 97, 97, 97, 97, 97, 97, 97, 18, 33, 19, 44, 57, 55, 42, 56,
-    52, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
-    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 148, 150, 97, 97,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    91, 52, 74, 1, 97, 97, 4, 3, 3, 45, 22, 31, 25, 61, 0, 27,
+    24, 28, 0, 91, 23, 34, 48, 36, 32, 97, 97, 97, 97, 97, 97, 97,
+    97, 97, 97, 97, 97, 97, 97, 18, 33, 19, 44, 57, 55, 42, 56, 47,
+    50, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
     97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
-    97, 97, 97, 97, 97, 58, 37, 30, 60, 38, 29, 35, 59, 180, 2, 2,
-    47, 50, 46, 49, 51, 40, 53, 54, 39, 3, 97, 97, 97, 97, 97, 97,
+    97, 154, 155, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    97, 97, 97, 97, 97, 97, 97, 97, 97, 58, 37, 30, 60, 38, 29, 35,
+    59, 46, 49, 51, 40, 53, 54, 39, 3, 97, 97, 97, 97, 2, 2, 2,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 92, 1, 62, 68, 68, 68, 4, 3,
+    0, 0, 0, 0, 0, 0, 0, 0, 92, 52, 74, 1, 68, 68, 4, 3,
     3, 45, 22, 31, 25, 61, 0, 27, 24, 28, 0, 69, 23, 34, 48, 36,
     32, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 18,
-    33, 19, 44, 57, 55, 42, 56, 52, 68, 68, 8, 68, 68, 68, 68, 68,
-    68, 68, 13, 68, 68, 68, 16, 5, 68, 66, 68, 68, 15, 68, 14, 68,
-    7, 68, 68, 68, 68, 68, 67, 68, 68, 6, 9, 68, 68, 68, 68, 68,
-    11, 68, 68, 68, 68, 68, 68, 68, 10, 68, 63, 64, 58, 37, 30, 60,
-    38, 29, 35, 59, 180, 2, 2, 47, 50, 46, 49, 51, 40, 53, 54, 39,
-    3, 68, 68, 68, 12, 17, 65, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    33, 19, 44, 57, 55, 42, 56, 47, 50, 68, 68, 68, 8, 68, 68, 12,
+    68, 68, 68, 65, 68, 68, 68, 68, 13, 68, 68, 68, 16, 5, 68, 66,
+    68, 68, 15, 68, 14, 68, 7, 68, 68, 68, 68, 67, 68, 68, 6, 9,
+    68, 68, 68, 68, 68, 68, 11, 68, 68, 68, 68, 64, 68, 68, 10, 68,
+    63, 58, 37, 30, 60, 38, 29, 35, 59, 46, 49, 51, 40, 53, 54, 39,
+    3, 68, 62, 68, 17, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 93,
-    1, 62, 68, 68, 68, 4, 3, 3, 45, 22, 31, 25, 61, 0, 27, 24,
-    28, 0, 69, 23, 177, 48, 36, 32, 68, 68, 68, 68, 68, 68, 68, 68,
-    68, 68, 68, 68, 68, 68, 18, 33, 19, 44, 57, 55, 42, 56, 52, 68,
-    68, 8, 68, 68, 68, 68, 68, 68, 68, 13, 68, 68, 68, 16, 5, 68,
-    66, 68, 68, 15, 68, 14, 68, 7, 68, 68, 68, 68, 68, 67, 68, 68,
-    6, 9, 68, 68, 68, 68, 68, 11, 68, 68, 68, 68, 68, 68, 68, 10,
-    68, 63, 64, 58, 37, 30, 60, 38, 29, 35, 59, 180, 2, 2, 47, 50,
-    46, 49, 51, 40, 53, 54, 39, 3, 68, 68, 68, 12, 17, 65, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    93, 52, 74, 1, 68, 68, 4, 3, 3, 45, 22, 31, 25, 61, 0, 27,
+    24, 28, 0, 69, 23, 182, 48, 36, 32, 68, 68, 68, 68, 68, 68, 68,
+    68, 68, 68, 68, 68, 68, 68, 18, 33, 19, 44, 57, 55, 42, 56, 47,
+    50, 68, 68, 68, 8, 68, 68, 12, 68, 68, 68, 65, 68, 68, 68, 68,
+    13, 68, 68, 68, 16, 5, 68, 66, 68, 68, 15, 68, 14, 68, 7, 68,
+    68, 68, 68, 67, 68, 68, 6, 9, 68, 68, 68, 68, 68, 68, 11, 68,
+    68, 68, 68, 64, 68, 68, 10, 68, 63, 58, 37, 30, 60, 38, 29, 35,
+    59, 46, 49, 51, 40, 53, 54, 39, 3, 68, 62, 68, 17, 2, 2, 2,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 94, 1, 62, 68, 68, 68, 4, 3, 3, 191,
-    22, 189, 25, 61, 187, 186, 24, 184, 119, 69, 23, 178, 176, 173, 172, 68,
-    68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 18, 116, 19,
-    115, 57, 55, 118, 56, 52, 68, 68, 8, 68, 68, 68, 68, 68, 68, 68,
-    13, 68, 68, 68, 16, 5, 68, 66, 68, 68, 15, 68, 14, 68, 7, 68,
-    68, 68, 68, 68, 67, 68, 68, 6, 9, 68, 68, 68, 68, 68, 11, 68,
-    68, 68, 68, 68, 68, 68, 10, 68, 63, 64, 58, 37, 175, 60, 38, 179,
-    35, 59, 180, 2, 2, 47, 50, 46, 49, 51, 190, 53, 54, 39, 3, 68,
-    68, 68, 12, 17, 65, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 94, 52, 74, 1, 68, 68, 4, 3,
+    3, 191, 22, 189, 25, 61, 187, 186, 24, 120, 73, 69, 23, 183, 181, 178,
+    177, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 18,
+    116, 19, 115, 57, 55, 118, 56, 47, 50, 68, 68, 68, 8, 68, 68, 12,
+    68, 68, 68, 65, 68, 68, 68, 68, 13, 68, 68, 68, 16, 5, 68, 66,
+    68, 68, 15, 68, 14, 68, 7, 68, 68, 68, 68, 67, 68, 68, 6, 9,
+    68, 68, 68, 68, 68, 68, 11, 68, 68, 68, 68, 64, 68, 68, 10, 68,
+    63, 58, 37, 180, 60, 38, 184, 35, 59, 46, 49, 51, 190, 53, 54, 39,
+    3, 68, 62, 68, 17, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 95, 1, 62,
-    68, 68, 68, 4, 3, 3, 45, 22, 31, 25, 61, 0, 27, 24, 28, 0,
-    69, 23, 34, 48, 174, 32, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
-    68, 68, 68, 68, 18, 33, 19, 44, 57, 55, 42, 56, 52, 68, 68, 8,
-    68, 68, 68, 68, 68, 68, 68, 13, 68, 68, 68, 16, 5, 68, 66, 68,
-    68, 15, 68, 14, 68, 7, 68, 68, 68, 68, 68, 67, 68, 68, 6, 9,
-    68, 68, 68, 68, 68, 11, 68, 68, 68, 68, 68, 68, 68, 10, 68, 63,
-    64, 58, 37, 30, 60, 38, 29, 35, 59, 180, 2, 2, 47, 50, 46, 49,
-    51, 40, 53, 54, 39, 3, 68, 68, 68, 12, 17, 65, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    95, 52, 74, 1, 68, 68, 4, 3, 3, 45, 22, 31, 25, 61, 0, 27,
+    24, 28, 0, 69, 23, 34, 48, 179, 32, 68, 68, 68, 68, 68, 68, 68,
+    68, 68, 68, 68, 68, 68, 68, 18, 33, 19, 44, 57, 55, 42, 56, 47,
+    50, 68, 68, 68, 8, 68, 68, 12, 68, 68, 68, 65, 68, 68, 68, 68,
+    13, 68, 68, 68, 16, 5, 68, 66, 68, 68, 15, 68, 14, 68, 7, 68,
+    68, 68, 68, 67, 68, 68, 6, 9, 68, 68, 68, 68, 68, 68, 11, 68,
+    68, 68, 68, 64, 68, 68, 10, 68, 63, 58, 37, 30, 60, 38, 29, 35,
+    59, 46, 49, 51, 40, 53, 54, 39, 3, 68, 62, 68, 17, 2, 2, 2,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 1, 97, 97, 97, 97, 4, 3, 3, 45, 22, 31,
-    25, 61, 0, 27, 24, 28, 0, 69, 23, 34, 48, 36, 32, 97, 97, 97,
-    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 18, 33, 19, 44, 57,
-    55, 42, 56, 52, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 74, 1, 97, 97, 4, 3,
+    3, 45, 22, 31, 25, 61, 0, 27, 24, 28, 0, 69, 23, 34, 48, 36,
+    32, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 18,
+    33, 19, 44, 57, 55, 42, 56, 47, 50, 97, 97, 97, 97, 97, 97, 97,
+    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
     97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
     97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
-    97, 97, 97, 97, 97, 97, 97, 97, 58, 37, 30, 60, 38, 29, 35, 59,
-    180, 2, 2, 47, 50, 46, 49, 51, 40, 53, 54, 39, 3, 97, 97, 97,
-    97, 97, 97, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    97, 58, 37, 30, 60, 38, 29, 35, 59, 46, 49, 51, 40, 53, 54, 39,
+    3, 97, 97, 97, 97, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 96, 1, 62, 68, 68,
-    68, 4, 3, 3, 45, 22, 31, 25, 61, 0, 27, 24, 28, 0, 69, 23,
-    34, 48, 36, 32, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
-    68, 68, 18, 33, 19, 44, 57, 55, 42, 56, 52, 68, 68, 8, 68, 68,
-    68, 68, 68, 68, 68, 13, 68, 68, 68, 16, 5, 68, 66, 68, 68, 15,
-    68, 14, 68, 7, 68, 68, 68, 68, 68, 67, 68, 68, 6, 9, 68, 68,
-    68, 68, 68, 11, 68, 68, 68, 68, 68, 68, 68, 10, 68, 63, 64, 58,
-    37, 30, 60, 38, 29, 35, 59, 180, 2, 2, 47, 50, 46, 49, 51, 40,
-    53, 54, 39, 3, 68, 68, 68, 12, 17, 65, 0, 0, 0, 0, 0, 0,
+    96, 52, 74, 1, 68, 68, 4, 3, 3, 45, 22, 31, 25, 61, 0, 27,
+    24, 28, 0, 69, 23, 34, 48, 36, 32, 68, 68, 68, 68, 68, 68, 68,
+    68, 68, 68, 68, 68, 68, 68, 18, 33, 19, 44, 57, 55, 42, 56, 47,
+    50, 68, 68, 68, 8, 68, 68, 12, 68, 68, 68, 65, 68, 68, 68, 68,
+    13, 68, 68, 68, 16, 5, 68, 66, 68, 68, 15, 68, 14, 68, 7, 68,
+    68, 68, 68, 67, 68, 68, 6, 9, 68, 68, 68, 68, 68, 68, 11, 68,
+    68, 68, 68, 64, 68, 68, 10, 68, 63, 58, 37, 30, 60, 38, 29, 35,
+    59, 46, 49, 51, 40, 53, 54, 39, 3, 68, 62, 68, 17, 2, 2, 2,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 97, 1, 97, 97, 97, 97, 4, 3, 3, 45, 22, 31, 25, 61,
-    0, 27, 24, 28, 0, 69, 23, 34, 48, 36, 32, 97, 97, 97, 97, 97,
-    97, 97, 97, 131, 97, 97, 97, 123, 97, 18, 33, 19, 44, 57, 55, 42,
-    56, 52, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    0, 0, 0, 0, 0, 0, 0, 0, 97, 52, 74, 1, 97, 97, 4, 3,
+    3, 45, 22, 31, 25, 61, 0, 27, 24, 28, 0, 69, 23, 34, 48, 36,
+    32, 97, 97, 97, 97, 97, 97, 97, 97, 137, 97, 97, 97, 76, 97, 18,
+    33, 19, 44, 57, 55, 42, 56, 47, 50, 97, 97, 97, 97, 97, 97, 97,
     97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
     97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
-    167, 97, 97, 97, 97, 97, 58, 37, 30, 60, 38, 29, 35, 59, 180, 2,
-    2, 47, 50, 46, 49, 51, 40, 53, 54, 39, 3, 97, 97, 97, 97, 97,
-    97, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 173, 97, 97, 97,
+    97, 58, 37, 30, 60, 38, 29, 35, 59, 46, 49, 51, 40, 53, 54, 39,
+    3, 97, 97, 97, 97, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 98, 1, 97, 97, 97, 97, 4,
-    3, 3, 45, 22, 31, 25, 61, 0, 27, 24, 28, 0, 69, 23, 34, 48,
-    36, 32, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
-    18, 33, 19, 44, 57, 55, 42, 56, 52, 97, 97, 97, 97, 97, 97, 97,
-    97, 97, 97, 97, 132, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    98, 52, 74, 1, 97, 97, 4, 3, 3, 45, 22, 31, 25, 61, 0, 27,
+    24, 28, 0, 69, 23, 34, 48, 36, 32, 97, 97, 97, 97, 97, 97, 97,
+    97, 97, 97, 97, 97, 97, 97, 18, 33, 19, 44, 57, 55, 42, 56, 47,
+    50, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    97, 138, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
     97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
-    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 58, 37, 30,
-    60, 38, 29, 35, 59, 180, 2, 2, 47, 50, 46, 49, 51, 40, 53, 54,
-    39, 3, 97, 97, 97, 97, 97, 97, 0, 0, 0, 0, 0, 0, 0, 0,
+    97, 97, 97, 97, 97, 97, 97, 97, 97, 58, 37, 30, 60, 38, 29, 35,
+    59, 46, 49, 51, 40, 53, 54, 39, 3, 97, 97, 97, 97, 2, 2, 2,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    99, 1, 97, 97, 97, 97, 4, 3, 3, 45, 22, 31, 25, 61, 0, 27,
-    24, 28, 0, 69, 23, 34, 48, 36, 32, 97, 97, 97, 97, 97, 97, 97,
-    97, 97, 97, 97, 97, 97, 97, 18, 33, 19, 44, 57, 55, 42, 56, 52,
+    0, 0, 0, 0, 0, 0, 0, 0, 99, 52, 74, 1, 97, 97, 4, 3,
+    3, 45, 22, 31, 25, 61, 0, 27, 24, 28, 0, 69, 23, 34, 48, 36,
+    32, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 18,
+    33, 19, 44, 57, 55, 42, 56, 47, 50, 97, 97, 97, 97, 97, 97, 97,
     97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
     97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
     97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
-    97, 97, 97, 97, 58, 37, 30, 60, 38, 29, 35, 59, 180, 2, 2, 47,
-    50, 46, 49, 51, 40, 53, 54, 39, 3, 97, 97, 97, 97, 97, 97, 0,
+    97, 58, 37, 30, 60, 38, 29, 35, 59, 46, 49, 51, 40, 53, 54, 39,
+    3, 97, 97, 97, 97, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 100, 1, 97, 97, 97, 97, 4, 3, 3,
-    45, 22, 31, 25, 61, 0, 27, 24, 28, 0, 69, 23, 34, 48, 36, 32,
-    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 18, 33,
-    19, 44, 57, 55, 42, 56, 52, 97, 97, 97, 97, 97, 74, 97, 97, 97,
+    100, 52, 74, 1, 97, 97, 4, 3, 3, 45, 22, 31, 25, 61, 0, 27,
+    24, 28, 0, 69, 23, 34, 48, 36, 32, 97, 97, 97, 97, 97, 97, 97,
+    97, 97, 97, 97, 97, 97, 97, 18, 33, 19, 44, 57, 55, 42, 56, 47,
+    50, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
     97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
-    97, 97, 97, 97, 147, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
-    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 58, 37, 30, 60, 38,
-    29, 35, 59, 180, 2, 2, 47, 50, 46, 49, 51, 40, 53, 54, 39, 3,
-    97, 97, 97, 97, 97, 97, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    153, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    97, 97, 97, 97, 97, 97, 97, 97, 97, 58, 37, 30, 60, 38, 29, 35,
+    59, 46, 49, 51, 40, 53, 54, 39, 3, 194, 97, 97, 97, 2, 2, 2,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 101, 1,
-    97, 97, 195, 97, 4, 3, 3, 45, 22, 31, 25, 61, 0, 27, 24, 28,
-    0, 69, 23, 34, 48, 36, 32, 97, 97, 97, 97, 97, 97, 97, 97, 97,
-    133, 97, 97, 97, 97, 18, 33, 19, 44, 57, 55, 42, 56, 52, 97, 122,
-    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 138, 97, 97, 97, 97, 97,
-    97, 97, 97, 97, 97, 97, 97, 97, 149, 97, 97, 97, 97, 97, 153, 97,
-    97, 97, 97, 97, 97, 160, 97, 97, 97, 166, 97, 171, 97, 97, 97, 97,
-    97, 97, 58, 37, 30, 60, 38, 29, 35, 59, 180, 2, 2, 47, 50, 46,
-    49, 51, 40, 53, 54, 39, 3, 97, 97, 97, 97, 97, 97, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 101, 52, 74, 1, 97, 97, 4, 3,
+    3, 45, 22, 31, 25, 61, 0, 27, 24, 28, 0, 69, 23, 34, 48, 36,
+    32, 97, 97, 97, 97, 97, 97, 97, 97, 97, 132, 97, 97, 97, 97, 18,
+    33, 19, 44, 57, 55, 42, 56, 47, 50, 97, 97, 124, 97, 126, 97, 97,
+    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 139, 97, 97, 97, 97, 97,
+    97, 97, 97, 97, 97, 97, 97, 152, 97, 97, 97, 97, 97, 158, 97, 97,
+    97, 97, 97, 97, 97, 166, 97, 97, 172, 97, 171, 97, 97, 97, 97, 97,
+    97, 58, 37, 30, 60, 38, 29, 35, 59, 46, 49, 51, 40, 53, 54, 39,
+    3, 97, 97, 97, 97, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 102, 1, 97, 97, 97, 97, 4, 3, 3, 45, 22,
-    31, 25, 61, 0, 27, 24, 28, 0, 69, 23, 34, 48, 36, 32, 97, 97,
-    97, 97, 97, 97, 97, 135, 97, 97, 97, 97, 97, 97, 18, 33, 19, 44,
-    57, 55, 42, 56, 52, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    102, 52, 74, 1, 97, 97, 4, 3, 3, 45, 22, 31, 25, 61, 0, 27,
+    24, 28, 0, 69, 23, 34, 48, 36, 32, 97, 97, 97, 97, 97, 97, 97,
+    141, 97, 97, 97, 97, 97, 97, 18, 33, 19, 44, 57, 55, 42, 56, 47,
+    50, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
     97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
     97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
     97, 97, 97, 97, 97, 97, 97, 97, 97, 58, 37, 30, 60, 38, 29, 35,
-    59, 180, 2, 2, 47, 50, 46, 49, 51, 40, 53, 54, 39, 3, 97, 97,
-    97, 97, 97, 97, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    59, 46, 49, 51, 40, 53, 54, 39, 3, 97, 97, 97, 97, 2, 2, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 103, 1, 97, 97,
-    97, 97, 4, 3, 3, 45, 22, 31, 25, 61, 0, 27, 24, 28, 0, 69,
-    23, 34, 48, 36, 32, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
-    97, 97, 97, 18, 33, 19, 44, 57, 55, 42, 56, 52, 97, 97, 97, 97,
+    0, 0, 0, 0, 0, 0, 0, 0, 103, 52, 74, 1, 97, 97, 4, 3,
+    3, 45, 22, 31, 25, 61, 0, 27, 24, 28, 0, 69, 23, 34, 48, 36,
+    32, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 18,
+    33, 19, 44, 57, 55, 42, 56, 47, 50, 97, 97, 97, 97, 97, 97, 97,
     97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
     97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
     97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
-    58, 37, 30, 60, 38, 29, 35, 59, 180, 2, 2, 47, 50, 46, 49, 51,
-    40, 53, 54, 39, 3, 97, 97, 97, 97, 97, 97, 0, 0, 0, 0, 0,
+    97, 58, 37, 30, 60, 38, 29, 35, 59, 46, 49, 51, 40, 53, 54, 39,
+    3, 97, 97, 97, 97, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 97, 1, 97, 97, 97, 97, 4, 3, 3, 45, 22, 31, 25,
-    61, 0, 27, 24, 28, 0, 69, 23, 34, 48, 36, 32, 97, 97, 97, 97,
-    97, 97, 97, 97, 97, 97, 77, 76, 97, 126, 18, 33, 19, 44, 57, 55,
-    42, 56, 52, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    97, 52, 74, 1, 97, 97, 4, 3, 3, 45, 22, 31, 25, 61, 0, 27,
+    24, 28, 0, 69, 23, 34, 48, 36, 32, 97, 97, 97, 97, 97, 97, 97,
+    97, 97, 97, 128, 125, 97, 121, 18, 33, 19, 44, 57, 55, 42, 56, 47,
+    50, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
     97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
     97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
-    97, 97, 97, 97, 97, 97, 97, 58, 37, 30, 60, 38, 29, 35, 59, 180,
-    2, 2, 47, 50, 46, 49, 51, 40, 53, 54, 39, 3, 97, 97, 97, 97,
-    97, 97, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    97, 97, 97, 97, 97, 97, 97, 97, 97, 58, 37, 30, 60, 38, 29, 35,
+    59, 46, 49, 51, 40, 53, 54, 39, 3, 97, 97, 97, 97, 2, 2, 2,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 104, 1, 97, 97, 97, 97,
-    4, 3, 3, 45, 22, 31, 25, 61, 0, 27, 24, 28, 0, 69, 23, 34,
-    48, 36, 32, 97, 97, 97, 97, 97, 141, 97, 97, 97, 97, 97, 97, 97,
-    97, 18, 33, 19, 44, 57, 55, 42, 56, 52, 97, 97, 97, 97, 125, 97,
-    120, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
-    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 157, 97,
-    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 58, 37,
-    30, 60, 38, 29, 35, 59, 180, 2, 2, 47, 50, 46, 49, 51, 40, 53,
-    54, 39, 3, 97, 97, 97, 97, 97, 97, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 104, 52, 74, 1, 97, 193, 4, 3,
+    3, 45, 22, 31, 25, 61, 0, 27, 24, 28, 0, 69, 23, 34, 48, 36,
+    32, 97, 97, 97, 97, 97, 147, 97, 97, 97, 97, 97, 97, 97, 97, 18,
+    33, 19, 44, 57, 55, 42, 56, 47, 50, 122, 97, 97, 97, 97, 97, 97,
+    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    97, 97, 163, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    97, 58, 37, 30, 60, 38, 29, 35, 59, 46, 49, 51, 40, 53, 54, 39,
+    3, 97, 97, 97, 97, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 97, 1, 97, 97, 97, 97, 4, 3, 3, 45, 22, 31, 25, 61, 0,
-    27, 24, 28, 0, 69, 23, 34, 48, 36, 32, 97, 97, 97, 97, 97, 97,
-    97, 97, 97, 97, 97, 97, 97, 97, 18, 33, 19, 44, 57, 55, 42, 56,
-    52, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    97, 52, 74, 1, 97, 97, 4, 3, 3, 45, 22, 31, 25, 61, 0, 27,
+    24, 28, 0, 69, 23, 34, 48, 36, 32, 97, 97, 97, 97, 97, 97, 97,
+    97, 97, 97, 97, 97, 97, 97, 18, 33, 19, 44, 57, 55, 42, 56, 47,
+    50, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
     97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
     97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
-    97, 97, 97, 97, 97, 58, 37, 30, 60, 38, 29, 35, 59, 180, 2, 2,
-    47, 50, 46, 49, 51, 40, 53, 54, 39, 3, 97, 97, 97, 97, 97, 97,
+    97, 97, 97, 97, 97, 97, 97, 97, 97, 58, 37, 30, 60, 38, 29, 35,
+    59, 46, 49, 51, 40, 53, 54, 39, 3, 97, 97, 97, 97, 2, 2, 2,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 97, 1, 97, 97, 97, 97, 4, 3,
+    0, 0, 0, 0, 0, 0, 0, 0, 97, 52, 74, 1, 97, 97, 4, 3,
     3, 45, 22, 31, 25, 61, 0, 27, 24, 28, 0, 69, 23, 34, 48, 36,
     32, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 18,
-    33, 19, 44, 57, 55, 42, 56, 52, 97, 97, 97, 97, 97, 97, 97, 97,
+    33, 19, 44, 57, 55, 42, 56, 47, 50, 97, 97, 97, 97, 97, 97, 97,
     97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
     97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
-    97, 97, 97, 97, 97, 97, 97, 168, 97, 97, 97, 97, 58, 37, 30, 60,
-    38, 29, 35, 59, 180, 2, 2, 47, 50, 46, 49, 51, 40, 53, 54, 39,
-    3, 97, 97, 97, 97, 97, 97, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 174, 97, 97,
+    97, 58, 37, 30, 60, 38, 29, 35, 59, 46, 49, 51, 40, 53, 54, 39,
+    3, 97, 97, 97, 97, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 105,
-    1, 97, 97, 97, 97, 4, 3, 3, 45, 22, 31, 25, 61, 0, 27, 24,
-    28, 0, 69, 23, 34, 48, 36, 32, 97, 97, 97, 97, 151, 97, 97, 97,
-    97, 97, 97, 97, 97, 97, 18, 33, 19, 44, 57, 55, 42, 56, 52, 121,
-    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
-    97, 134, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    105, 52, 74, 1, 97, 97, 4, 3, 3, 45, 22, 31, 25, 61, 0, 27,
+    24, 28, 0, 69, 23, 34, 48, 36, 32, 97, 97, 97, 97, 156, 97, 97,
+    97, 97, 97, 97, 97, 97, 97, 18, 33, 19, 44, 57, 55, 42, 56, 47,
+    50, 97, 123, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    97, 97, 97, 140, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
     97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
-    170, 97, 97, 58, 37, 30, 60, 38, 29, 35, 59, 180, 2, 2, 47, 50,
-    46, 49, 51, 40, 53, 54, 39, 3, 97, 97, 97, 97, 97, 97, 0, 0,
+    97, 97, 97, 97, 97, 97, 97, 176, 97, 58, 37, 30, 60, 38, 29, 35,
+    59, 46, 49, 51, 40, 53, 54, 39, 3, 97, 97, 97, 97, 2, 2, 2,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 97, 1, 97, 97, 97, 97, 4, 3, 3, 45,
-    22, 31, 25, 61, 0, 27, 24, 28, 0, 69, 23, 34, 48, 36, 32, 97,
-    97, 97, 97, 97, 142, 97, 136, 97, 97, 97, 97, 97, 97, 18, 33, 19,
-    44, 57, 55, 42, 56, 52, 97, 97, 97, 97, 97, 97, 97, 97, 97, 130,
+    0, 0, 0, 0, 0, 0, 0, 0, 97, 52, 74, 1, 97, 97, 4, 3,
+    3, 45, 22, 31, 25, 61, 0, 27, 24, 28, 0, 69, 23, 34, 48, 36,
+    32, 97, 97, 97, 97, 97, 148, 97, 142, 97, 97, 97, 97, 97, 97, 18,
+    33, 19, 44, 57, 55, 42, 56, 47, 50, 97, 97, 97, 97, 97, 127, 97,
+    97, 97, 97, 97, 97, 97, 97, 136, 97, 97, 97, 97, 97, 97, 97, 97,
     97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
-    97, 97, 97, 97, 97, 97, 97, 97, 97, 162, 97, 158, 97, 97, 97, 97,
-    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 58, 37, 30, 60, 38, 29,
-    35, 59, 180, 2, 2, 47, 50, 46, 49, 51, 40, 53, 54, 39, 3, 97,
-    97, 196, 97, 97, 97, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    161, 97, 97, 164, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    97, 58, 37, 30, 60, 38, 29, 35, 59, 46, 49, 51, 40, 53, 54, 39,
+    3, 97, 97, 97, 97, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 97, 1, 97,
-    97, 97, 193, 4, 3, 3, 45, 22, 31, 25, 61, 0, 27, 24, 28, 0,
-    69, 23, 34, 48, 36, 32, 97, 161, 155, 154, 97, 143, 139, 97, 97, 97,
-    97, 97, 124, 97, 18, 33, 19, 44, 57, 55, 42, 56, 52, 97, 97, 97,
-    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
-    97, 97, 97, 97, 97, 97, 140, 97, 97, 97, 97, 97, 97, 97, 97, 97,
-    97, 97, 97, 97, 97, 97, 169, 97, 97, 97, 97, 97, 97, 97, 97, 97,
-    97, 58, 37, 30, 60, 38, 29, 35, 59, 180, 2, 2, 47, 50, 46, 49,
-    51, 40, 53, 54, 39, 3, 97, 97, 97, 97, 97, 97, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    97, 52, 74, 1, 97, 97, 4, 3, 3, 45, 22, 31, 25, 61, 0, 27,
+    24, 28, 0, 69, 23, 34, 48, 36, 32, 97, 167, 160, 159, 97, 149, 144,
+    97, 97, 97, 97, 97, 77, 97, 18, 33, 19, 44, 57, 55, 42, 56, 47,
+    50, 97, 97, 97, 97, 97, 97, 97, 129, 97, 97, 97, 97, 97, 97, 97,
+    97, 97, 97, 97, 97, 97, 97, 97, 97, 146, 97, 97, 97, 97, 97, 97,
+    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 175,
+    97, 97, 97, 97, 97, 97, 97, 97, 97, 58, 37, 30, 60, 38, 29, 35,
+    59, 46, 49, 51, 40, 53, 54, 39, 3, 97, 97, 97, 97, 2, 2, 2,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 106, 1, 97, 97, 97, 97, 4, 3, 3, 45, 22, 31,
-    25, 61, 0, 27, 24, 28, 0, 69, 23, 34, 48, 36, 32, 97, 163, 97,
-    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 18, 33, 19, 44, 57,
-    55, 42, 56, 52, 97, 97, 97, 75, 97, 97, 97, 97, 129, 97, 97, 97,
-    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 144, 97, 97, 97, 97,
+    0, 0, 0, 0, 0, 0, 0, 0, 106, 52, 74, 1, 195, 97, 4, 3,
+    3, 45, 22, 31, 25, 61, 0, 27, 24, 28, 0, 69, 23, 34, 48, 36,
+    32, 97, 168, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 18,
+    33, 19, 44, 57, 55, 42, 56, 47, 50, 97, 97, 97, 97, 97, 97, 97,
+    97, 130, 97, 97, 97, 97, 135, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    97, 97, 97, 97, 97, 150, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
     97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
-    97, 97, 97, 97, 97, 97, 97, 97, 58, 37, 30, 60, 38, 29, 35, 59,
-    2, 2, 2, 47, 50, 46, 49, 51, 40, 53, 54, 39, 3, 194, 97, 97,
-    97, 97, 97, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    97, 58, 37, 30, 60, 38, 29, 35, 59, 46, 49, 51, 40, 53, 54, 39,
+    3, 97, 97, 97, 97, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 107, 1, 97, 197, 97,
-    97, 4, 3, 3, 45, 22, 31, 25, 61, 0, 27, 24, 28, 0, 69, 23,
-    34, 48, 36, 32, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
-    97, 97, 18, 33, 19, 44, 57, 55, 42, 56, 52, 97, 97, 97, 97, 97,
+    107, 52, 74, 1, 97, 97, 4, 3, 3, 45, 22, 31, 25, 61, 0, 27,
+    24, 28, 0, 69, 23, 34, 48, 36, 32, 97, 97, 97, 97, 97, 97, 97,
+    97, 97, 97, 97, 97, 97, 97, 18, 33, 19, 44, 57, 55, 42, 56, 47,
+    50, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
     97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
-    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 152, 97, 97, 97, 97, 97,
-    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 58,
-    37, 30, 60, 38, 29, 35, 59, 180, 2, 2, 47, 50, 46, 49, 51, 40,
-    53, 54, 39, 3, 97, 97, 97, 97, 97, 97, 0, 0, 0, 0, 0, 0,
+    97, 97, 97, 97, 157, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    97, 97, 97, 97, 97, 97, 97, 97, 97, 58, 37, 30, 60, 38, 29, 35,
+    59, 46, 49, 51, 40, 53, 54, 39, 3, 97, 97, 196, 97, 2, 2, 2,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 108, 1, 97, 97, 97, 97, 4, 3, 3, 45, 22, 31, 25, 61,
-    0, 27, 24, 28, 0, 69, 23, 34, 48, 36, 32, 97, 97, 97, 97, 97,
-    97, 97, 97, 97, 97, 97, 97, 97, 97, 18, 33, 19, 44, 57, 55, 42,
-    56, 52, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 127,
-    97, 97, 137, 97, 97, 145, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
-    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 156, 97, 165, 97,
-    97, 97, 97, 97, 97, 97, 58, 37, 30, 60, 38, 29, 35, 59, 180, 2,
-    2, 47, 50, 46, 49, 51, 40, 53, 54, 39, 3, 97, 198, 97, 97, 97,
-    97, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 108, 52, 74, 1, 97, 97, 4, 3,
+    3, 45, 22, 31, 25, 61, 0, 27, 24, 28, 0, 69, 23, 34, 48, 36,
+    32, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 18,
+    33, 19, 44, 57, 55, 42, 56, 47, 50, 97, 97, 97, 97, 97, 97, 97,
+    97, 97, 131, 97, 133, 97, 97, 97, 97, 97, 97, 97, 97, 97, 143, 97,
+    145, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    97, 162, 97, 97, 97, 97, 97, 97, 97, 170, 97, 97, 97, 97, 97, 97,
+    97, 58, 37, 30, 60, 38, 29, 35, 59, 46, 49, 51, 40, 53, 54, 39,
+    3, 97, 97, 97, 97, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 97, 1, 97, 97, 97, 97, 4,
-    3, 3, 45, 22, 31, 25, 61, 0, 27, 24, 28, 0, 69, 23, 34, 48,
-    36, 32, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
-    18, 33, 19, 44, 57, 55, 42, 56, 52, 97, 97, 97, 97, 97, 97, 97,
-    128, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
-    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 159,
-    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 58, 37, 30,
-    60, 38, 29, 35, 59, 180, 2, 2, 47, 50, 46, 49, 51, 40, 53, 54,
-    39, 3, 97, 97, 97, 97, 97, 97, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    97, 52, 74, 1, 97, 97, 4, 3, 3, 45, 22, 31, 25, 61, 0, 27,
+    24, 28, 0, 69, 23, 34, 48, 36, 32, 97, 97, 97, 97, 97, 97, 97,
+    97, 97, 97, 97, 97, 97, 97, 18, 33, 19, 44, 57, 55, 42, 56, 47,
+    50, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 134, 97, 97,
+    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 165, 97, 97, 97,
+    97, 97, 97, 97, 97, 97, 97, 97, 97, 58, 37, 30, 60, 38, 29, 35,
+    59, 46, 49, 51, 40, 53, 54, 39, 3, 97, 97, 97, 97, 2, 2, 2,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    109, 1, 97, 97, 97, 97, 4, 3, 3, 45, 22, 31, 25, 61, 0, 27,
-    24, 28, 0, 69, 23, 34, 48, 36, 32, 97, 97, 97, 97, 97, 97, 97,
-    97, 97, 97, 97, 97, 97, 97, 18, 33, 19, 44, 57, 55, 42, 56, 52,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 109, 52, 74, 1, 97, 97, 4, 3,
+    3, 45, 22, 31, 25, 61, 0, 27, 24, 28, 0, 69, 23, 34, 48, 36,
+    32, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 18,
+    33, 19, 44, 57, 55, 42, 56, 47, 50, 97, 97, 97, 97, 97, 97, 97,
     97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
     97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
     97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
-    97, 97, 97, 97, 58, 37, 30, 60, 38, 29, 35, 59, 180, 2, 2, 47,
-    50, 46, 49, 51, 40, 53, 54, 39, 3, 97, 97, 97, 97, 97, 97, 0,
+    97, 58, 37, 30, 60, 38, 29, 35, 59, 46, 49, 51, 40, 53, 54, 39,
+    3, 97, 97, 97, 97, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 110, 1, 97, 97, 97, 97, 4, 3, 3,
-    45, 22, 31, 25, 61, 0, 27, 24, 28, 0, 69, 23, 34, 48, 36, 32,
-    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 18, 33,
-    19, 44, 57, 55, 42, 56, 52, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    110, 52, 74, 1, 97, 97, 4, 3, 3, 45, 22, 31, 25, 61, 0, 27,
+    24, 28, 0, 69, 23, 34, 48, 36, 32, 97, 97, 97, 97, 97, 97, 97,
+    97, 97, 97, 97, 97, 97, 97, 18, 33, 19, 44, 57, 55, 42, 56, 47,
+    50, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
     97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
     97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
-    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 58, 37, 30, 60, 38,
-    29, 35, 59, 180, 2, 2, 47, 50, 46, 49, 51, 40, 53, 54, 39, 3,
-    97, 97, 97, 97, 97, 97, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    97, 97, 97, 97, 97, 97, 97, 97, 97, 58, 37, 30, 60, 38, 29, 35,
+    59, 46, 49, 51, 40, 53, 54, 39, 3, 97, 97, 97, 97, 2, 2, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 97, 1,
-    97, 97, 97, 97, 4, 3, 3, 45, 22, 31, 25, 61, 0, 27, 24, 28,
-    0, 69, 23, 34, 48, 36, 32, 97, 97, 97, 97, 97, 97, 97, 97, 97,
-    97, 97, 97, 97, 97, 18, 33, 19, 44, 57, 55, 42, 56, 52, 97, 97,
+    0, 0, 0, 0, 0, 0, 0, 0, 97, 52, 74, 1, 97, 97, 4, 3,
+    3, 45, 22, 31, 25, 61, 0, 27, 24, 28, 0, 69, 23, 34, 48, 36,
+    32, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 18,
+    33, 19, 44, 57, 55, 42, 56, 47, 50, 97, 97, 97, 97, 97, 97, 97,
     97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
-    97, 97, 97, 146, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    97, 97, 97, 151, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
     97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
-    97, 97, 58, 37, 30, 60, 38, 29, 35, 59, 180, 2, 2, 47, 50, 46,
-    49, 51, 40, 53, 54, 39, 3, 97, 97, 97, 97, 97, 97, 0, 0, 0,
+    97, 58, 37, 30, 60, 38, 29, 35, 59, 46, 49, 51, 40, 53, 54, 39,
+    3, 97, 97, 97, 97, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 97, 1, 97, 97, 97, 97, 4, 3, 3, 45, 22,
-    31, 25, 61, 0, 27, 24, 28, 0, 69, 23, 34, 48, 36, 32, 97, 164,
-    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 18, 33, 19, 44,
-    57, 55, 42, 56, 52, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    97, 52, 74, 1, 97, 97, 4, 3, 3, 45, 22, 31, 25, 61, 0, 27,
+    24, 28, 0, 69, 23, 34, 48, 36, 32, 97, 169, 97, 97, 97, 97, 97,
+    97, 97, 97, 97, 97, 97, 97, 18, 33, 19, 44, 57, 55, 42, 56, 47,
+    50, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
     97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
     97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
     97, 97, 97, 97, 97, 97, 97, 97, 97, 58, 37, 30, 60, 38, 29, 35,
-    59, 180, 2, 2, 47, 50, 46, 49, 51, 40, 53, 54, 39, 3, 97, 97,
-    97, 97, 97, 97, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    59, 46, 49, 51, 40, 53, 54, 39, 3, 97, 97, 97, 97, 2, 2, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 111, 1, 62, 68,
-    68, 68, 4, 3, 3, 45, 22, 31, 25, 61, 0, 27, 24, 28, 0, 69,
-    23, 34, 48, 36, 32, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
-    68, 68, 68, 18, 33, 19, 44, 57, 55, 42, 56, 52, 68, 68, 8, 68,
-    68, 68, 68, 68, 68, 68, 13, 68, 68, 68, 16, 5, 68, 66, 68, 68,
-    15, 68, 14, 68, 7, 68, 68, 68, 68, 68, 67, 68, 68, 6, 9, 68,
-    68, 68, 68, 68, 11, 68, 68, 68, 68, 68, 68, 68, 10, 68, 63, 64,
-    58, 37, 30, 60, 38, 29, 35, 59, 180, 2, 2, 47, 50, 46, 49, 51,
-    40, 53, 54, 39, 3, 68, 68, 68, 12, 17, 65, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 111, 52, 74, 1, 68, 68, 4, 3,
+    3, 45, 22, 31, 25, 61, 0, 27, 24, 28, 0, 69, 23, 34, 48, 36,
+    32, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 18,
+    33, 19, 44, 57, 55, 42, 56, 47, 50, 68, 68, 68, 8, 68, 68, 12,
+    68, 68, 68, 65, 68, 68, 68, 68, 13, 68, 68, 68, 16, 5, 68, 66,
+    68, 68, 15, 68, 14, 68, 7, 68, 68, 68, 68, 67, 68, 68, 6, 9,
+    68, 68, 68, 68, 68, 68, 11, 68, 68, 68, 68, 64, 68, 68, 10, 68,
+    63, 58, 37, 30, 60, 38, 29, 35, 59, 46, 49, 51, 40, 53, 54, 39,
+    3, 68, 62, 68, 17, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    112, 52, 74, 1, 68, 68, 4, 3, 3, 45, 22, 31, 25, 61, 0, 27,
+    24, 28, 0, 69, 23, 34, 48, 36, 32, 68, 68, 68, 68, 68, 68, 68,
+    68, 68, 68, 68, 68, 68, 68, 18, 117, 19, 44, 57, 55, 42, 56, 47,
+    50, 68, 68, 68, 8, 68, 68, 12, 68, 68, 68, 65, 68, 68, 68, 68,
+    13, 68, 68, 68, 16, 5, 68, 66, 68, 68, 15, 68, 14, 68, 7, 68,
+    68, 68, 68, 67, 68, 68, 6, 9, 68, 68, 68, 68, 68, 68, 11, 68,
+    68, 68, 68, 64, 68, 68, 10, 68, 63, 58, 37, 30, 60, 38, 29, 35,
+    59, 46, 49, 51, 40, 53, 54, 39, 3, 68, 62, 68, 17, 2, 2, 2,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 112, 1, 62, 68, 68, 68, 4, 3, 3, 45, 22, 31, 25,
-    61, 0, 27, 24, 28, 0, 69, 23, 34, 48, 36, 32, 68, 68, 68, 68,
-    68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 18, 117, 19, 44, 57, 55,
-    42, 56, 52, 68, 68, 8, 68, 68, 68, 68, 68, 68, 68, 13, 68, 68,
-    68, 16, 5, 68, 66, 68, 68, 15, 68, 14, 68, 7, 68, 68, 68, 68,
-    68, 67, 68, 68, 6, 9, 68, 68, 68, 68, 68, 11, 68, 68, 68, 68,
-    68, 68, 68, 10, 68, 63, 64, 58, 37, 30, 60, 38, 29, 35, 59, 180,
-    2, 2, 47, 50, 46, 49, 51, 40, 53, 54, 39, 3, 68, 68, 68, 12,
-    17, 65, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 113, 1, 62, 68, 68, 68,
-    4, 3, 3, 45, 22, 31, 25, 61, 0, 27, 24, 28, 0, 69, 23, 34,
-    48, 36, 32, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
-    68, 18, 33, 19, 44, 57, 55, 42, 56, 52, 68, 68, 8, 68, 68, 68,
-    68, 68, 68, 68, 13, 68, 68, 68, 16, 5, 68, 66, 68, 68, 15, 68,
-    14, 68, 7, 68, 68, 68, 68, 68, 67, 68, 68, 6, 9, 68, 68, 68,
-    68, 68, 11, 68, 68, 68, 68, 68, 68, 68, 10, 68, 63, 64, 58, 37,
-    30, 60, 38, 29, 35, 59, 180, 2, 2, 47, 50, 46, 49, 51, 40, 53,
-    54, 39, 3, 68, 68, 68, 12, 17, 65, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 113, 52, 74, 1, 68, 68, 4, 3,
+    3, 45, 22, 31, 25, 61, 0, 27, 24, 28, 0, 69, 23, 34, 48, 36,
+    32, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 18,
+    33, 19, 44, 57, 55, 42, 56, 47, 50, 68, 68, 68, 8, 68, 68, 12,
+    68, 68, 68, 65, 68, 68, 68, 68, 13, 68, 68, 68, 16, 5, 68, 66,
+    68, 68, 15, 68, 14, 68, 7, 68, 68, 68, 68, 67, 68, 68, 6, 9,
+    68, 68, 68, 68, 68, 68, 11, 68, 68, 68, 68, 64, 68, 68, 10, 68,
+    63, 58, 37, 30, 60, 38, 29, 35, 59, 46, 49, 51, 40, 53, 54, 39,
+    3, 68, 62, 68, 17, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 114, 1, 62, 68, 68, 68, 4, 3, 3, 45, 22, 31, 25, 61, 0,
-    27, 24, 28, 0, 69, 23, 34, 48, 36, 32, 68, 68, 68, 68, 68, 68,
-    68, 68, 68, 68, 68, 68, 68, 68, 18, 33, 19, 44, 57, 55, 42, 56,
-    52, 68, 68, 8, 68, 68, 68, 68, 68, 68, 68, 13, 68, 68, 68, 16,
-    5, 68, 66, 68, 68, 15, 68, 14, 68, 7, 68, 68, 68, 68, 68, 67,
-    68, 68, 6, 9, 68, 68, 68, 68, 68, 11, 68, 68, 68, 68, 68, 68,
-    68, 10, 68, 63, 64, 58, 37, 30, 60, 38, 29, 35, 59, 180, 2, 2,
-    47, 50, 46, 49, 51, 40, 53, 54, 39, 3, 68, 68, 68, 12, 17, 65,
+    114, 52, 74, 1, 68, 68, 4, 3, 3, 45, 22, 31, 25, 61, 0, 27,
+    24, 28, 0, 69, 23, 34, 48, 36, 32, 68, 68, 68, 68, 68, 68, 68,
+    68, 68, 68, 68, 68, 68, 68, 18, 33, 19, 44, 57, 55, 42, 56, 47,
+    50, 68, 68, 68, 8, 68, 68, 12, 68, 68, 68, 65, 68, 68, 68, 68,
+    13, 68, 68, 68, 16, 5, 68, 66, 68, 68, 15, 68, 14, 68, 7, 68,
+    68, 68, 68, 67, 68, 68, 6, 9, 68, 68, 68, 68, 68, 68, 11, 68,
+    68, 68, 68, 64, 68, 68, 10, 68, 63, 58, 37, 30, 60, 38, 29, 35,
+    59, 46, 49, 51, 40, 53, 54, 39, 3, 68, 62, 68, 17, 2, 2, 2,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 62, 68, 68, 68, 4, 3,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 0, 1, 68, 68, 4, 3,
     3, 45, 22, 31, 25, 61, 0, 27, 24, 28, 0, 69, 23, 34, 48, 36,
     32, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 18,
-    33, 19, 44, 57, 55, 42, 56, 52, 68, 68, 8, 68, 68, 68, 68, 68,
-    68, 68, 13, 68, 68, 68, 16, 5, 68, 66, 68, 68, 15, 68, 14, 68,
-    7, 68, 68, 68, 68, 68, 67, 68, 68, 6, 9, 68, 68, 68, 68, 68,
-    11, 68, 68, 68, 68, 68, 68, 68, 10, 68, 63, 64, 58, 37, 30, 60,
-    38, 29, 35, 59, 2, 2, 2, 47, 50, 46, 49, 51, 40, 53, 54, 39,
-    3, 68, 68, 68, 12, 17, 65,
+    33, 19, 44, 57, 55, 42, 56, 47, 50, 68, 68, 68, 8, 68, 68, 12,
+    68, 68, 68, 65, 68, 68, 68, 68, 13, 68, 68, 68, 16, 5, 68, 66,
+    68, 68, 15, 68, 14, 68, 7, 68, 68, 68, 68, 67, 68, 68, 6, 9,
+    68, 68, 68, 68, 68, 68, 11, 68, 68, 68, 68, 64, 68, 68, 10, 68,
+    63, 58, 37, 30, 60, 38, 29, 35, 59, 46, 49, 51, 40, 53, 54, 39,
+    3, 68, 62, 68, 17, 2, 2, 2,
 };
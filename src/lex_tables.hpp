@@ -1,3 +1,5 @@
+#ifndef LEX_TABLES_HPP
+#define LEX_TABLES_HPP
 #include <cstdint>
 #include <string_view>
 using token_type_t = std::uint32_t;
@@ -368,5 +370,14 @@ constexpr unsigned char token_precedence_table[] =
 
 constexpr token_type_t TOK_LAST_STATE = 71;
 constexpr token_type_t TOK_START = 72;
-extern unsigned const lexer_ec_table[256];
-extern token_type_t const lexer_transition_table[9751];
+constexpr unsigned LEXER_NUM_STATES = 200;
+using lexer_state_t = std::uint8_t;
+#define LEXER_COMPRESSED 0
+extern std::uint16_t const lexer_ec_table[256];
+extern lexer_state_t const lexer_transition_table[9800];
+[[gnu::always_inline]]
+inline lexer_state_t lexer_next(unsigned state, unsigned char c)
+{
+    return lexer_transition_table[state + lexer_ec_table[c]];
+}
+#endif
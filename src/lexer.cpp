@@ -0,0 +1,246 @@
+#include "lexer.hpp"
+
+#include <cstring>
+
+#include "builtin.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define LEXER_X86
+#include <immintrin.h>
+#endif
+
+lex_run_t lexer_run_table[LEXER_NUM_STATES];
+lex_skip_fn_t lexer_skip_fns[NUM_RUNS];
+
+namespace
+{
+    constexpr bool in_run(lex_run_t run, unsigned char c)
+    {
+        switch(run)
+        {
+        default:
+            return false;
+        case RUN_INDENT:
+            return c == ' ';
+        case RUN_SPACE:
+            return c == ' ' || c == '\t';
+        case RUN_DIGIT:
+            return c >= '0' && c <= '9';
+        case RUN_IDENT:
+            return (c == '_' || (c >= '0' && c <= '9')
+                    || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'));
+        case RUN_COMMENT:
+            return c != '\n' && c != '\r' && c != '\0';
+        }
+    }
+
+    template<lex_run_t Run>
+    char const* skip_scalar(char const* ptr)
+    {
+        while(in_run(Run, *ptr))
+            ++ptr;
+        return ptr;
+    }
+
+#ifdef LEXER_X86
+    // Returns a movemask with bits set for every byte that ends the run.
+    template<lex_run_t Run> [[gnu::always_inline]]
+    inline unsigned sse2_stop_mask(__m128i v)
+    {
+        __m128i in;
+        switch(Run)
+        {
+        case RUN_INDENT:
+            in = _mm_cmpeq_epi8(v, _mm_set1_epi8(' '));
+            break;
+        case RUN_SPACE:
+            in = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')),
+                              _mm_cmpeq_epi8(v, _mm_set1_epi8('\t')));
+            break;
+        case RUN_DIGIT:
+        case RUN_IDENT:
+            {
+                // Unsigned range checks: (c - lo) <= (hi - lo)
+                __m128i const d = _mm_sub_epi8(v, _mm_set1_epi8('0'));
+                in = _mm_cmpeq_epi8(_mm_min_epu8(d, _mm_set1_epi8(9)), d);
+                if(Run == RUN_DIGIT)
+                    break;
+                // Lowercasing with |0x20 maps letters onto a-z,
+                // and doesn't map anything else onto a-z.
+                __m128i const l = _mm_sub_epi8(
+                    _mm_or_si128(v, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+                in = _mm_or_si128(in,
+                    _mm_cmpeq_epi8(_mm_min_epu8(l, _mm_set1_epi8(25)), l));
+                in = _mm_or_si128(in, _mm_cmpeq_epi8(v, _mm_set1_epi8('_')));
+            }
+            break;
+        case RUN_COMMENT:
+            {
+                __m128i stop = _mm_cmpeq_epi8(v, _mm_setzero_si128());
+                stop = _mm_or_si128(stop,
+                    _mm_cmpeq_epi8(v, _mm_set1_epi8('\n')));
+                stop = _mm_or_si128(stop,
+                    _mm_cmpeq_epi8(v, _mm_set1_epi8('\r')));
+                return _mm_movemask_epi8(stop);
+            }
+        default:
+            __builtin_unreachable();
+        }
+        return ~_mm_movemask_epi8(in) & 0xFFFFu;
+    }
+
+    // Aligned loads never cross a page boundary, so it's safe to read
+    // the rest of the block past the '\0' terminator.
+    template<lex_run_t Run>
+    char const* skip_sse2(char const* ptr)
+    {
+        if(!in_run(Run, *ptr)) // Short runs are common.
+            return ptr;
+
+        std::uintptr_t const offset = reinterpret_cast<std::uintptr_t>(ptr) & 15;
+        __m128i const* block = reinterpret_cast<__m128i const*>(ptr - offset);
+        unsigned mask = sse2_stop_mask<Run>(_mm_load_si128(block)) >> offset;
+        if(mask)
+            return ptr + builtin::ctz(mask);
+
+        while(true)
+        {
+            ++block;
+            mask = sse2_stop_mask<Run>(_mm_load_si128(block));
+            if(mask)
+                return reinterpret_cast<char const*>(block)
+                       + builtin::ctz(mask);
+        }
+    }
+
+    template<lex_run_t Run> [[gnu::always_inline, gnu::target("avx2")]]
+    inline unsigned avx2_stop_mask(__m256i v)
+    {
+        __m256i in;
+        switch(Run)
+        {
+        case RUN_INDENT:
+            in = _mm256_cmpeq_epi8(v, _mm256_set1_epi8(' '));
+            break;
+        case RUN_SPACE:
+            in = _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')),
+                                 _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\t')));
+            break;
+        case RUN_DIGIT:
+        case RUN_IDENT:
+            {
+                __m256i const d = _mm256_sub_epi8(v, _mm256_set1_epi8('0'));
+                in = _mm256_cmpeq_epi8(
+                    _mm256_min_epu8(d, _mm256_set1_epi8(9)), d);
+                if(Run == RUN_DIGIT)
+                    break;
+                __m256i const l = _mm256_sub_epi8(
+                    _mm256_or_si256(v, _mm256_set1_epi8(0x20)),
+                    _mm256_set1_epi8('a'));
+                in = _mm256_or_si256(in, _mm256_cmpeq_epi8(
+                    _mm256_min_epu8(l, _mm256_set1_epi8(25)), l));
+                in = _mm256_or_si256(in,
+                    _mm256_cmpeq_epi8(v, _mm256_set1_epi8('_')));
+            }
+            break;
+        case RUN_COMMENT:
+            {
+                __m256i stop = _mm256_cmpeq_epi8(v, _mm256_setzero_si256());
+                stop = _mm256_or_si256(stop,
+                    _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\n')));
+                stop = _mm256_or_si256(stop,
+                    _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\r')));
+                return _mm256_movemask_epi8(stop);
+            }
+        default:
+            __builtin_unreachable();
+        }
+        return ~static_cast<unsigned>(_mm256_movemask_epi8(in));
+    }
+
+    template<lex_run_t Run> [[gnu::target("avx2")]]
+    char const* skip_avx2(char const* ptr)
+    {
+        if(!in_run(Run, *ptr))
+            return ptr;
+
+        std::uintptr_t const offset = reinterpret_cast<std::uintptr_t>(ptr) & 31;
+        __m256i const* block = reinterpret_cast<__m256i const*>(ptr - offset);
+        unsigned mask = avx2_stop_mask<Run>(_mm256_load_si256(block)) >> offset;
+        if(mask)
+            return ptr + builtin::ctz(mask);
+
+        while(true)
+        {
+            ++block;
+            mask = avx2_stop_mask<Run>(_mm256_load_si256(block));
+            if(mask)
+                return reinterpret_cast<char const*>(block)
+                       + builtin::ctz(mask);
+        }
+    }
+#endif
+
+    char const* skip_none(char const* ptr) { return ptr; }
+
+    char const* impl_name = "scalar";
+
+    // Fills 'lexer_run_table' and 'lexer_skip_fns' before 'main' runs.
+    struct lexer_init_t
+    {
+        lexer_init_t()
+        {
+            // A state gets a run if every byte of the run loops back to it.
+            // Check the widest runs first, as they skip the most.
+            constexpr lex_run_t runs[] =
+                { RUN_COMMENT, RUN_IDENT, RUN_DIGIT, RUN_SPACE };
+
+            for(unsigned state = TOK_LAST_STATE + 1;
+                state < LEXER_NUM_STATES; ++state)
+            {
+                for(lex_run_t run : runs)
+                {
+                    for(unsigned c = 0; c < 256; ++c)
+                        if(in_run(run, c) && lexer_next(state, c) != state)
+                            goto next_run;
+                    lexer_run_table[state] = run;
+                    break;
+                next_run:;
+                }
+            }
+
+            lexer_skip_fns[RUN_NONE] = &skip_none;
+            lexer_skip_fns[RUN_INDENT]  = &skip_scalar<RUN_INDENT>;
+            lexer_skip_fns[RUN_SPACE]   = &skip_scalar<RUN_SPACE>;
+            lexer_skip_fns[RUN_DIGIT]   = &skip_scalar<RUN_DIGIT>;
+            lexer_skip_fns[RUN_IDENT]   = &skip_scalar<RUN_IDENT>;
+            lexer_skip_fns[RUN_COMMENT] = &skip_scalar<RUN_COMMENT>;
+
+#ifdef LEXER_X86
+            __builtin_cpu_init();
+            if(__builtin_cpu_supports("avx2"))
+            {
+                impl_name = "avx2";
+                lexer_skip_fns[RUN_INDENT]  = &skip_avx2<RUN_INDENT>;
+                lexer_skip_fns[RUN_SPACE]   = &skip_avx2<RUN_SPACE>;
+                lexer_skip_fns[RUN_DIGIT]   = &skip_avx2<RUN_DIGIT>;
+                lexer_skip_fns[RUN_IDENT]   = &skip_avx2<RUN_IDENT>;
+                lexer_skip_fns[RUN_COMMENT] = &skip_avx2<RUN_COMMENT>;
+            }
+            else if(__builtin_cpu_supports("sse2"))
+            {
+                impl_name = "sse2";
+                lexer_skip_fns[RUN_INDENT]  = &skip_sse2<RUN_INDENT>;
+                lexer_skip_fns[RUN_SPACE]   = &skip_sse2<RUN_SPACE>;
+                lexer_skip_fns[RUN_DIGIT]   = &skip_sse2<RUN_DIGIT>;
+                lexer_skip_fns[RUN_IDENT]   = &skip_sse2<RUN_IDENT>;
+                lexer_skip_fns[RUN_COMMENT] = &skip_sse2<RUN_COMMENT>;
+            }
+#endif
+        }
+    };
+
+    lexer_init_t const lexer_init;
+} // end anon namespace
+
+char const* lex_skip_impl_name() { return impl_name; }
@@ -0,0 +1,68 @@
+#ifndef LEXER_HPP
+#define LEXER_HPP
+
+// The lexer's inner loop, which runs the DFA from lex_tables.hpp.
+//
+// Stepping the DFA one byte at a time is slow for long tokens like
+// comments and identifiers, where every byte loops back to the same state.
+// So whenever the DFA enters one of these "run" states, the rest of the run
+// gets skipped using a SIMD scanner, and the DFA resumes on the byte that
+// ended it.
+
+#include <cstdint>
+
+#include "lex_tables.hpp"
+
+// The byte classes the scanners know how to skip over.
+enum lex_run_t : std::uint8_t
+{
+    RUN_NONE,
+    RUN_INDENT,  // ' '
+    RUN_SPACE,   // ' ', '\t'
+    RUN_DIGIT,   // 0-9
+    RUN_IDENT,   // A-Z, a-z, 0-9, _
+    RUN_COMMENT, // Anything but '\n', '\r', and '\0'.
+    NUM_RUNS,
+};
+
+using lex_skip_fn_t = char const* (*)(char const*);
+
+// Maps each DFA state to the run it loops on, or RUN_NONE.
+// This is derived from the DFA tables at startup.
+extern lex_run_t lexer_run_table[LEXER_NUM_STATES];
+
+// The scanners for each run; the best implementation for the CPU.
+extern lex_skip_fn_t lexer_skip_fns[NUM_RUNS];
+
+// Returns a pointer to the first byte at or after 'ptr' that isn't in 'run'.
+// The input has to be '\0'-terminated, and is read in aligned blocks,
+// possibly past the terminator (but never past its block).
+[[gnu::always_inline]]
+inline char const* lex_skip(lex_run_t run, char const* ptr)
+{
+    return lexer_skip_fns[run](ptr);
+}
+
+// Lexes one token. Returns the token's type and updates 'next_char' to
+// point one past the token's end.
+// When 'Fast' is false, the DFA runs byte-by-byte with no skipping.
+template<bool Fast = true> [[gnu::always_inline]]
+inline token_type_t lex_token(char const*& next_char)
+{
+    token_type_t lexed = TOK_START;
+    while(lexed > TOK_LAST_STATE)
+    {
+        unsigned char const c = *next_char;
+        lexed = lexer_next(lexed, c);
+        ++next_char;
+        if(Fast && lexer_run_table[lexed])
+            next_char = lex_skip(lexer_run_table[lexed], next_char);
+    }
+    --next_char;
+    return lexed;
+}
+
+// Names which scanner implementation was selected, for benchmarks.
+char const* lex_skip_impl_name();
+
+#endif
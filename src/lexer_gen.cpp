@@ -1,7 +1,11 @@
 // A quick-n-dirty lexer generator; an alternative to 'lex' and 'flex'.
 
 #include <ctype.h>
+#include <algorithm>
+#include <array>
+#include <cstdint>
 #include <cstdio>
+#include <cstring>
 #include <deque>
 #include <map>
 #include <memory>
@@ -356,13 +360,35 @@ void print_dfa(dfa_t const& dfa)
     }
 }
 
-void print_output(dfa_t const& dfa, fc::vector_set<dfa_set_t> const& mini)
+// Returns the narrowest unsigned type that can hold 'max'.
+char const* uint_type(unsigned max)
+{
+    if(max <= 0xFF)
+        return "std::uint8_t";
+    if(max <= 0xFFFF)
+        return "std::uint16_t";
+    return "std::uint32_t";
+}
+
+void print_table(std::FILE* cpp, char const* type, char const* name, 
+                 unsigned const* data, unsigned size)
+{
+    std::fprintf(cpp, "extern %s const %s[%u] = {", type, name, size);
+    for(unsigned i = 0; i < size; ++i)
+        std::fprintf(cpp, "%s%u,", i % 16 == 0 ? "\n    " : " ", data[i]);
+    std::fprintf(cpp, "\n};\n");
+}
+
+void print_output(dfa_t const& dfa, fc::vector_set<dfa_set_t> const& mini,
+                  bool compress)
 {
     std::FILE* hpp = std::fopen("lex_tables.hpp", "w");
     std::FILE* cpp = std::fopen("lex_tables.cpp", "w");
 
     std::unordered_map<dfa_set_t const*, unsigned> nodes;
     std::vector<dfa_set_t const*> node_vector;
+    std::fprintf(hpp, "#ifndef LEX_TABLES_HPP\n");
+    std::fprintf(hpp, "#define LEX_TABLES_HPP\n");
     std::fprintf(hpp, "#include <cstdint>\n");
     std::fprintf(hpp, "#include <string_view>\n");
     std::fprintf(hpp, "using token_type_t = std::uint32_t;\n");
@@ -422,8 +448,8 @@ void print_output(dfa_t const& dfa, fc::vector_set<dfa_set_t> const& mini)
             std::fprintf(hpp, "    case TOK_%s:\\\n", p.second.second->name);
     std::fprintf(hpp, "\n");
 
-    std::fprintf(hpp, "constexpr token_type_t TOK_LAST_STATE = %u;\n", 
-                (unsigned)nodes.size() - 1);
+    unsigned const last_state = nodes.size() - 1;
+    std::fprintf(hpp, "constexpr token_type_t TOK_LAST_STATE = %u;\n", last_state);
 
     for(dfa_set_t const& s : mini)
         if(nodes.emplace(&s, nodes.size()).second)
@@ -440,6 +466,9 @@ void print_output(dfa_t const& dfa, fc::vector_set<dfa_set_t> const& mini)
     }
 exit_loop:
 
+    std::fprintf(hpp, "constexpr unsigned LEXER_NUM_STATES = %u;\n", 
+                 (unsigned)node_vector.size());
+
     fc::vector_map<dfa_set_t const*, fc::vector_set<unsigned>> outgoing; 
     fc::vector_set<fc::vector_set<unsigned>> char_sets; 
     fc::vector_set<fc::vector_set<unsigned>> char_ec; 
@@ -493,21 +522,19 @@ exit_loop:
     {
         if(char_ec.container[j].count(i))
         {
-            ec_table[i] = j * node_vector.size();
+            ec_table[i] = j;
             break;
         }
     }
 
-    std::fprintf(cpp, "#include \"lex_tables.hpp\"\n");
-    std::fprintf(cpp, "extern unsigned const lexer_ec_table[256] = {");
-    for(unsigned i = 0 ; i != 256; ++i)
-        std::fprintf(cpp, "%s%i,", i % 16 == 0 ? "\n    " : " ", ec_table[i]);
-    std::fprintf(cpp, "\n};\n");
+    unsigned const num_states = node_vector.size();
+    unsigned const num_ec = char_ec.size();
 
-    std::vector<unsigned> ttable(char_ec.size() * node_vector.size(), 0);
-    for(unsigned i = 0; i < char_ec.size(); ++i)
+    // Indexed by [ec * num_states + state].
+    std::vector<unsigned> ttable(num_ec * num_states, 0);
+    for(unsigned i = 0; i < num_ec; ++i)
     {
-        for(unsigned j = 0; j < node_vector.size(); ++j)
+        for(unsigned j = 0; j < num_states; ++j)
         {
             if(node_vector[j] == nullptr)
                 continue;
@@ -518,7 +545,7 @@ exit_loop:
                 auto it = np->second.map.find(c);
                 if(it != np->second.map.end())
                 {
-                    ttable[i*node_vector.size()+j] = nodes[it->second->second.dfa_set];
+                    ttable[i*num_states+j] = nodes[it->second->second.dfa_set];
                     goto assigned;
                 }
             }
@@ -529,18 +556,119 @@ exit_loop:
                     best_index = std::min(best_index, nodes[it->second->second.dfa_set]);
             }
             if(best_index != -1u)
-                ttable[i*node_vector.size()+j] = best_index;
+                ttable[i*num_states+j] = best_index;
         assigned:;
         }
     }
 
-    std::fprintf(cpp, "extern token_type_t const lexer_transition_table[%u] = {\n", (unsigned)ttable.size());
-    for(unsigned i = 0; i < ttable.size(); ++i)
-        std::fprintf(cpp, "%s%i,", i % 16 == 0 ? "\n    " : " ", ttable[i]);
-    std::fprintf(cpp, "\n};\n");
+    std::fprintf(hpp, "using lexer_state_t = %s;\n", uint_type(num_states - 1));
+    std::fprintf(cpp, "#include \"lex_tables.hpp\"\n");
 
-    std::fprintf(hpp, "extern unsigned const lexer_ec_table[256];\n");
-    std::fprintf(hpp, "extern token_type_t const lexer_transition_table[%u];\n", (unsigned)ttable.size());
+    if(!compress)
+    {
+        // A dense table, with the equivalence classes pre-multiplied 
+        // so that a lookup is a single add.
+        for(unsigned& ec : ec_table)
+            ec *= num_states;
+
+        char const* ec_type = uint_type((num_ec - 1) * num_states);
+        print_table(cpp, ec_type, "lexer_ec_table", ec_table.data(), 256);
+        print_table(cpp, "lexer_state_t", "lexer_transition_table", 
+                    ttable.data(), ttable.size());
+
+        std::fprintf(hpp, "#define LEXER_COMPRESSED 0\n");
+        std::fprintf(hpp, "extern %s const lexer_ec_table[256];\n", ec_type);
+        std::fprintf(hpp, "extern lexer_state_t const lexer_transition_table[%u];\n", 
+                     (unsigned)ttable.size());
+        std::fprintf(hpp, "[[gnu::always_inline]]\n");
+        std::fprintf(hpp, "inline lexer_state_t lexer_next(unsigned state, unsigned char c)\n{\n");
+        std::fprintf(hpp, "    return lexer_transition_table[state + lexer_ec_table[c]];\n");
+        std::fprintf(hpp, "}\n");
+    }
+    else
+    {
+        // Row displacement: each state's row is stored sparsely,
+        // with the entries that differ from the row's most common target 
+        // overlaid into a shared table, offset by 'lexer_base'.
+        // 'lexer_check' records which state owns each slot.
+        // Only non-final states get looked up, so TOK_ERROR (0) can
+        // mark the unowned slots.
+        std::vector<unsigned> defaults(num_states, 0);
+        std::vector<std::vector<unsigned>> rows(num_states);
+        for(unsigned j = last_state + 1; j < num_states; ++j)
+        {
+            std::map<unsigned, unsigned> counts;
+            for(unsigned i = 0; i < num_ec; ++i)
+                counts[ttable[i*num_states+j]] += 1;
+            defaults[j] = std::max_element(counts.begin(), counts.end(), 
+                [](auto const& a, auto const& b) { return a.second < b.second; })->first;
+            for(unsigned i = 0; i < num_ec; ++i)
+                if(ttable[i*num_states+j] != defaults[j])
+                    rows[j].push_back(i);
+        }
+
+        // Place the densest rows first; they're the hardest to fit.
+        std::vector<unsigned> order(num_states);
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](unsigned a, unsigned b)
+            { return rows[a].size() > rows[b].size(); });
+
+        std::vector<unsigned> base(num_states, 0);
+        std::vector<unsigned> check;
+        std::vector<unsigned> next;
+        for(unsigned j : order)
+        {
+            if(rows[j].empty())
+                continue;
+            unsigned b = 0;
+            for(;; ++b)
+            {
+                for(unsigned i : rows[j])
+                    if(b + i < check.size() && check[b + i] != 0)
+                        goto next_base;
+                break;
+            next_base:;
+            }
+            base[j] = b;
+            for(unsigned i : rows[j])
+            {
+                if(b + i >= check.size())
+                {
+                    check.resize(b + i + 1, 0);
+                    next.resize(b + i + 1, 0);
+                }
+                check[b + i] = j;
+                next[b + i] = ttable[i*num_states+j];
+            }
+        }
+
+        // Pad so that every lookup stays in bounds.
+        unsigned const size = *std::max_element(base.begin(), base.end()) + num_ec;
+        check.resize(std::max<std::size_t>(size, check.size()), 0);
+        next.resize(check.size(), 0);
+
+        char const* ec_type = uint_type(num_ec - 1);
+        char const* base_type = uint_type(size);
+        print_table(cpp, ec_type, "lexer_ec_table", ec_table.data(), 256);
+        print_table(cpp, base_type, "lexer_base", base.data(), base.size());
+        print_table(cpp, "lexer_state_t", "lexer_default", defaults.data(), defaults.size());
+        print_table(cpp, "lexer_state_t", "lexer_check", check.data(), check.size());
+        print_table(cpp, "lexer_state_t", "lexer_displaced", next.data(), next.size());
+
+        std::fprintf(hpp, "#define LEXER_COMPRESSED 1\n");
+        std::fprintf(hpp, "extern %s const lexer_ec_table[256];\n", ec_type);
+        std::fprintf(hpp, "extern %s const lexer_base[%u];\n", base_type, num_states);
+        std::fprintf(hpp, "extern lexer_state_t const lexer_default[%u];\n", num_states);
+        std::fprintf(hpp, "extern lexer_state_t const lexer_check[%u];\n", (unsigned)check.size());
+        std::fprintf(hpp, "extern lexer_state_t const lexer_displaced[%u];\n", (unsigned)next.size());
+        std::fprintf(hpp, "[[gnu::always_inline]]\n");
+        std::fprintf(hpp, "inline lexer_state_t lexer_next(unsigned state, unsigned char c)\n{\n");
+        std::fprintf(hpp, "    unsigned const i = lexer_base[state] + lexer_ec_table[c];\n");
+        std::fprintf(hpp, "    return lexer_check[i] == state ? lexer_displaced[i] : lexer_default[state];\n");
+        std::fprintf(hpp, "}\n");
+    }
+
+    std::fprintf(hpp, "#endif\n");
 
     std::fclose(hpp);
     std::fclose(cpp);
@@ -561,14 +689,17 @@ rptr idchar() { return pred(is_idchar); }
 rptr upper() { return pred(&isupper); }
 rptr lower() { return pred(&islower); }
 rptr newline() { return uor(word("\n"), word("\r"), word("\n\r"), word("\r\n")); }
-rptr comchar() { return pred([](unsigned char c) { return c != '\n' && c != 'r' && c; }); }
+rptr comchar() { return pred([](unsigned char c) { return c != '\n' && c != '\r' && c; }); }
 rptr eof() { return pred([](unsigned char c) { return c == '\0'; }); }
 rptr whitespace() { return pred([](unsigned char c) { return c == ' ' || c == '\t'; }); }
 rptr type() { return many1(cat(upper(), many1(pred(is_lower_or_digit)))); }
 rptr digit() { return pred(isdigit); }
 
-int main()
+// Pass '--compress' to emit row-displaced tables instead of a dense table.
+int main(int argc, char** argv)
 {
+    bool const compress = argc > 1 && std::strcmp(argv[1], "--compress") == 0;
+
     std::deque<nfa_node_t> nfa_nodes;
     nfa_t nfa = gen_nfa(*
         uor(
@@ -673,7 +804,7 @@ int main()
         nfa_nodes);
     dfa_t dfa = nfa_to_dfa(nfa);
 
-    print_output(dfa, minimize_dfa(dfa));
+    print_output(dfa, minimize_dfa(dfa), compress);
 
     //nfa_t nfa = gen_nfa(*pred(&isdigit), nfa_nodes);
     //print_nfa(nfa, nfa_nodes);
@@ -2,13 +2,14 @@
 
 #include "format.hpp"
 #include "globals.hpp"
+#include "mem_report.hpp"
 
 std::string to_string(locator_t loc)
 {
     switch(loc.lclass())
     {
     case LCLASS_GLOBAL:
-        return loc.global().name;
+        return std::string(loc.global().name);
     case LCLASS_GLOBAL_SET:
         return fmt("gset %:%", loc.index(), loc.byte());
     case LCLASS_THIS_ARG:
@@ -46,7 +47,7 @@ void locator_manager_t::setup(global_t const& global)
     locs.clear();
     map.clear();
 
-    unsigned set_size = bitset_size<>(global_t::num_vars());
+    unsigned set_size = global.fn().bitset_size();
 
     // 'named_set' will hold all globals mentioned by name inside this fn.
     bitset_uint_t* named_set = bitset_pool.alloc(set_size);
@@ -64,8 +65,8 @@ void locator_manager_t::setup(global_t const& global)
     {
         if(idep->gclass() == GLOBAL_FN)
         {
-            bitset_or(set_size, initial_set, idep->fn().reads());
-            bitset_or(set_size, initial_set, idep->fn().writes());
+            idep->fn().reads().or_into(set_size, initial_set);
+            idep->fn().writes().or_into(set_size, initial_set);
         }
         else if(idep->gclass() == GLOBAL_VAR)
         {
@@ -99,6 +100,10 @@ void locator_manager_t::setup(global_t const& global)
         bitset_uint_t any_comp = 0;
         bitset_uint_t* comp_set = bitset_pool.alloc(set_size);
 
+        bitset_uint_t* rw_set = bitset_pool.alloc(set_size);
+        idep->fn().reads().or_into(set_size, rw_set);
+        idep->fn().writes().or_into(set_size, rw_set);
+
         for(bitset_uint_t* in_set : eq_classes)
         {
             // Split the eq class set into two locs:
@@ -107,8 +112,7 @@ void locator_manager_t::setup(global_t const& global)
 
             for(unsigned i = 0; i < set_size; ++i)
             {
-                bitset_uint_t rw = 
-                    idep->fn().reads()[i] | idep->fn().writes()[i];
+                bitset_uint_t const rw = rw_set[i];
                 any_comp |= (comp_set[i] = in_set[i] & ~rw);
                 any_in |= (in_set[i] &= rw);
             }
@@ -144,6 +148,8 @@ void locator_manager_t::setup(global_t const& global)
         });
         locs.push_back(eq_classes[i]);
     }
+
+    mem_high_water(MEM_locator_bitset_pool, bitset_pool.capacity_bytes());
 }
 
 locator_t locator_manager_t::locator(global_t const& global) const
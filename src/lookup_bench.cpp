@@ -0,0 +1,122 @@
+// Stress-tests the global name table with many threads resolving
+// overlapping sets of names, comparing a single lock against shards.
+//
+// Usage: lookup_bench [names] [lookups per thread]
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "fnv1a.hpp"
+#include "sharded_pool.hpp"
+
+namespace
+{
+    // Deterministic, so that runs are comparable.
+    struct rng_t
+    {
+        std::uint64_t state = 0x853c49e6748fea9bull;
+
+        unsigned operator()(unsigned n)
+        {
+            state = state * 6364136223846793005ull + 1442695040888963407ull;
+            return (state >> 33) % n;
+        }
+    };
+
+    struct entry_t
+    {
+        explicit entry_t(std::string const& name) : name(name) {}
+        std::string const name;
+    };
+
+    struct name_t
+    {
+        std::string str;
+        std::uint32_t hash;
+    };
+
+    std::vector<name_t> gen_names(unsigned count)
+    {
+        static char const chars[] =
+            "abcdefghijklmnopqrstuvwxyz_0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+        rng_t rng;
+        std::vector<name_t> names(count);
+        for(unsigned i = 0; i < count; ++i)
+        {
+            names[i].str = "g" + std::to_string(i) + "_";
+            unsigned const size = 2 + rng(12);
+            for(unsigned j = 0; j < size; ++j)
+                names[i].str.push_back(chars[rng(sizeof(chars) - 1)]);
+            names[i].hash = fnv1a<std::uint32_t>::hash(names[i].str);
+        }
+        return names;
+    }
+
+    // Each thread looks up names from a window that overlaps
+    // half of its neighbor's window, in random order.
+    // Returns lookups per second.
+    template<unsigned ShardBits>
+    double run(std::vector<name_t> const& names, unsigned num_threads,
+               unsigned lookups)
+    {
+        sharded_pool_t<entry_t, ShardBits> pool;
+        std::size_t const window = names.size() / 2;
+
+        auto const start = std::chrono::steady_clock::now();
+
+        std::vector<std::thread> threads;
+        for(unsigned t = 0; t < num_threads; ++t)
+        {
+            threads.emplace_back([&, t]
+            {
+                rng_t rng;
+                rng.state += t;
+                std::size_t const base = (t * window / 2) % names.size();
+                for(unsigned i = 0; i < lookups; ++i)
+                {
+                    name_t const& name =
+                        names[(base + rng(window)) % names.size()];
+                    entry_t& entry = pool.emplace(name.hash,
+                        [&](entry_t const& e) { return e.name == name.str; },
+                        name.str);
+                    if(entry.name.size() != name.str.size())
+                        std::abort();
+                }
+            });
+        }
+        for(std::thread& thread : threads)
+            thread.join();
+
+        std::chrono::duration<double> const secs =
+            std::chrono::steady_clock::now() - start;
+
+        if(pool.size() > names.size())
+            std::abort();
+
+        return double(num_threads) * lookups / secs.count();
+    }
+} // end anon namespace
+
+int main(int argc, char** argv)
+{
+    unsigned const num_names = argc > 1 ? std::atoi(argv[1]) : 50000;
+    unsigned const lookups = argc > 2 ? std::atoi(argv[2]) : 1000000;
+
+    std::vector<name_t> const names = gen_names(num_names);
+    std::printf("%u names, %u lookups per thread\n", num_names, lookups);
+    std::printf("%8s %16s %16s\n",
+                "threads", "1 lock (M/s)", "64 shards (M/s)");
+
+    for(unsigned threads : { 1, 2, 4, 8, 16, 32 })
+    {
+        double const single = run<0>(names, threads, lookups);
+        double const sharded = run<6>(names, threads, lookups);
+        std::printf("%8u %16.1f %16.1f\n",
+                    threads, single / 1e6, sharded / 1e6);
+    }
+}
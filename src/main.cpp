@@ -1,20 +1,231 @@
 // This project is licensed under the Boost Software License.
 // See license.txt for details.
 
+#include <chrono>
 #include <cstdlib>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <thread>
+
+#include <sys/resource.h>
 
 #include <boost/program_options.hpp>
 
 #include "file.hpp"
+#include "mem_report.hpp"
+#include "module.hpp"
 #include "options.hpp"
 #include "parser.hpp"
 #include "pass1.hpp"
+#include "profile.hpp"
 #include "thread.hpp"
+#include "trace.hpp"
 
 extern char __GIT_COMMIT;
 
 namespace po = boost::program_options;
+namespace fs = std::filesystem;
+
+namespace
+{
+    // Compiles the input files, start to finish.
+    // Only 'parse_files' get parsed. The others' globals have to have been
+    // kept from the previous build, as have the modules' when 'kept'.
+    void compile_program(std::vector<bool> const& parse_files, bool kept)
+    {
+        // Parse the files, loading everything into globals.
+        // Globals start compiling as soon as they and their ideps
+        // are ready, while the rest of the files are still parsing.
+        set_compiler_phase(PHASE_PARSE);
+        global_t::init_ready_queue(compiler_options().num_threads);
+        if(!kept)
+            for(std::string const& path : compiler_options().modules)
+                import_module(path);
+        for(std::string const& name : compiler_options().entry_points)
+            global_t::add_entry_point(name);
+        {
+            profile_scope_t scope("parse phase");
+
+            // Large files get split at their top-level definitions,
+            // allowing a single file to be parsed by several threads.
+            std::vector<std::vector<parse_chunk_t>> file_chunks(
+                source_file_names.size());
+            std::atomic<unsigned> next_file_i = 0;
+            parallelize(compiler_options().num_threads,
+            [&](std::atomic<bool>& exception_thrown)
+            {
+                while(!exception_thrown)
+                {
+                    unsigned const file_i = next_file_i++;
+                    if(file_i >= source_file_names.size())
+                        return;
+                    if(!parse_files[file_i])
+                        continue;
+
+                    profile_scope_t scope("split_top_level");
+                    file_contents_t file(file_i);
+                    split_top_level(file, min_parse_chunk_size, 
+                                    file_chunks[file_i]);
+                }
+            });
+
+            std::vector<parse_chunk_t> chunks;
+            for(auto const& vec : file_chunks)
+                chunks.insert(chunks.end(), vec.begin(), vec.end());
+
+            std::atomic<unsigned> next_chunk_i = 0;
+            parallelize(compiler_options().num_threads,
+            [&](std::atomic<bool>& exception_thrown)
+            {
+                while(!exception_thrown)
+                {
+                    // Compiling first keeps the ready queue short.
+                    if(global_t::compile_one_ready())
+                        continue;
+
+                    unsigned const chunk_i = next_chunk_i++;
+                    if(chunk_i >= chunks.size())
+                        return;
+
+                    profile_scope_t scope("parse");
+                    file_contents_t file(chunks[chunk_i].file_i);
+                    global_t::parse_arena_t arena;
+                    parse<pass1_t>(file, chunks[chunk_i]);
+                }
+            });
+        }
+
+        // Check for undefined globals and prioritize the rest:
+        set_compiler_phase(PHASE_ORDER_GLOBALS);
+        {
+            profile_scope_t scope("order phase");
+            global_t::build_order();
+        }
+
+        // Compile the globals that are left:
+        set_compiler_phase(PHASE_COMPILE);
+        {
+            profile_scope_t scope("compile phase");
+            global_t::compile_all();
+        }
+
+        if(!compiler_options().emit_module.empty())
+        {
+            profile_scope_t scope("write_module");
+            write_module(compiler_options().emit_module);
+        }
+
+        if(compiler_options().time_report)
+            write_time_report(std::cout);
+
+        if(compiler_options().mem_report)
+            write_mem_report(std::cout);
+
+        if(!compiler_options().trace_file.empty())
+            write_trace(compiler_options().trace_file);
+
+        if(compiler_options().report_critical_path)
+            global_t::report_critical_path(std::cout);
+
+        if(compiler_options().report_reachability)
+            global_t::report_reachability(std::cout);
+
+        if(compiler_options().report_memory)
+        {
+            rusage usage;
+            if(getrusage(RUSAGE_SELF, &usage) == 0)
+                std::cout << "Peak memory: " << usage.ru_maxrss << " KiB\n";
+        }
+    }
+
+    std::vector<fs::file_time_type> input_times()
+    {
+        std::vector<fs::file_time_type> times;
+        for(std::string const& name : source_file_names)
+        {
+            std::error_code ec;
+            times.push_back(fs::last_write_time(name, ec));
+        }
+        return times;
+    }
+
+    // Writes the status of a build for editors and such to pick up.
+    // The file gets replaced whole, so readers never see it half-written.
+    void write_status(std::string const& status)
+    {
+        std::string const& path = compiler_options().status_file;
+        if(path.empty())
+            return;
+
+        std::string const tmp_path = path + ".tmp";
+        {
+            std::ofstream os(tmp_path);
+            os << status;
+        }
+        std::error_code ec;
+        fs::rename(tmp_path, path, ec);
+    }
+
+    // Rebuilds whenever an input file changes, forever.
+    // After a successful build, the globals of unchanged files are kept
+    // compiled. Only the changed files get parsed again, along with the
+    // files of any globals using theirs. Of those, fns whose code and
+    // ideps' summaries didn't change load from the compile cache.
+    // A failed build, or a change to a file defining vars, starts the
+    // next build over from scratch.
+    [[noreturn]] void watch()
+    {
+        using namespace std::chrono;
+
+        std::vector<bool> parse_files(source_file_names.size(), true);
+        bool kept = false;
+        for(unsigned build = 1;; ++build)
+        {
+            std::vector<fs::file_time_type> const times = input_times();
+            auto const start = steady_clock::now();
+
+            std::string result;
+            bool ok = false;
+            try
+            {
+                compile_program(parse_files, kept);
+                result = "ok";
+                ok = true;
+            }
+            catch(std::exception& e)
+            {
+                result = fmt("error\n%", e.what());
+            }
+
+            double const ms = 
+                duration<double, std::milli>(steady_clock::now() - start)
+                .count();
+            std::string const status = 
+                fmt("build % %ms %\n", build, ms, result);
+            std::cout << status << std::flush;
+            write_status(status);
+
+            unload_files();
+            reset_profile();
+            reset_mem_report();
+            reset_compiler_phase();
+
+            std::vector<fs::file_time_type> new_times;
+            while((new_times = input_times()) == times)
+                std::this_thread::sleep_for(milliseconds(100));
+
+            for(unsigned i = 0; i < parse_files.size(); ++i)
+                parse_files[i] = new_times[i] != times[i];
+            kept = ok && global_t::reset_files(parse_files);
+            if(!kept)
+            {
+                global_t::reset();
+                parse_files.assign(parse_files.size(), true);
+            }
+        }
+    }
+} // end anon namespace
 
 int main(int argc, char** argv)
 {
@@ -41,6 +252,36 @@ int main(int argc, char** argv)
                 ("graphviz,g", "output graphviz files")
                 ("optimize,O", "optimize code")
                 ("threads,j", po::value<int>(), "number of compiler threads")
+                ("no-mmap", "read input files instead of memory-mapping them "
+                 "(implied by --watch)")
+                ("report-critical-path", 
+                 "print the chain of globals that bounded the compile")
+                ("speculate", 
+                 "compile fns before their callees, when threads are idle")
+                ("entry,e", po::value<std::vector<std::string>>(), 
+                 "only compile what this global uses (can be repeated)")
+                ("report-reachability", 
+                 "print what was skipped for being unreachable")
+                ("report-memory", "print the peak memory used")
+                ("mem-report", 
+                 "print the memory held by each pool and allocations made")
+                ("time-report", 
+                 "print how long each phase and pass took")
+                ("trace-file", po::value<std::string>(), 
+                 "write a Chrome trace of each phase and pass")
+                ("trace", po::value<std::string>(), 
+                 fmt("print debug output for these categories: %", 
+                     trace_category_names()).c_str())
+                ("cache-dir", po::value<std::string>(), 
+                 "reuse unchanged fns compiled by previous runs")
+                ("module,m", po::value<std::vector<std::string>>(), 
+                 "import a precompiled module (can be repeated)")
+                ("emit-module", po::value<std::string>(), 
+                 "write the compiled vars and fns as a module "
+                 "(not with --entry)")
+                ("watch,w", "recompile whenever an input file changes")
+                ("status-file", po::value<std::string>(), 
+                 "in watch mode, write the result of each build here")
             ;
 
             po::positional_options_description p;
@@ -81,6 +322,67 @@ int main(int argc, char** argv)
             if(vm.count("graphviz"))
                 _options.graphviz = true;
 
+            if(vm.count("no-mmap"))
+                _options.mmap_files = false;
+
+            if(vm.count("report-critical-path"))
+                _options.report_critical_path = true;
+
+            if(vm.count("speculate"))
+                _options.speculate = true;
+
+            if(vm.count("entry"))
+                _options.entry_points = 
+                    vm["entry"].as<std::vector<std::string>>();
+
+            if(vm.count("report-reachability"))
+                _options.report_reachability = true;
+
+            if(vm.count("report-memory"))
+                _options.report_memory = true;
+
+            if(vm.count("mem-report"))
+                _options.mem_report = mem_report_enabled = true;
+
+            if(vm.count("time-report"))
+                _options.time_report = true;
+
+            if(vm.count("trace-file"))
+                _options.trace_file = vm["trace-file"].as<std::string>();
+
+            if(vm.count("trace"))
+                trace_mask = parse_trace_categories(
+                    vm["trace"].as<std::string>());
+
+            if(vm.count("cache-dir"))
+                _options.cache_dir = vm["cache-dir"].as<std::string>();
+
+            if(vm.count("module"))
+                _options.modules = 
+                    vm["module"].as<std::vector<std::string>>();
+
+            if(vm.count("emit-module"))
+                _options.emit_module = vm["emit-module"].as<std::string>();
+
+            // Fns left out by '--entry' wouldn't be in the module.
+            if(!_options.emit_module.empty()
+               && !_options.entry_points.empty())
+            {
+                throw std::runtime_error(
+                    "--emit-module can't be used with --entry.");
+            }
+
+            if(vm.count("watch"))
+            {
+                _options.watch = true;
+                // Editors can truncate a file while saving it, which
+                // would fault a mapping of it mid-parse. Read them instead.
+                _options.mmap_files = false;
+            }
+
+            if(vm.count("status-file"))
+                _options.status_file = vm["status-file"].as<std::string>();
+
             if(vm.count("threads"))
                 _options.num_threads = 
                     std::clamp(vm["threads"].as<int>(), 1, 64);
@@ -90,32 +392,15 @@ int main(int argc, char** argv)
         // OK! Now to do the actual work: //
         ////////////////////////////////////
 
-        // Parse the files, loading everything into globals:
-        set_compiler_phase(PHASE_PARSE);
-        std::atomic<unsigned> next_file_i = 0;
-        parallelize(compiler_options().num_threads,
-        [&next_file_i](std::atomic<bool>& exception_thrown)
-        {
-            while(!exception_thrown)
-            {
-                unsigned const file_i = next_file_i++;
-                if(file_i >= source_file_names.size())
-                    return;
-
-                file_contents_t file(file_i);
-                parse<pass1_t>(file);
-            }
-        });
-
-        // Create an ordering of all the globals:
-        set_compiler_phase(PHASE_ORDER_GLOBALS);
-        global_t::build_order();
-
-        // Compile each global:
-        set_compiler_phase(PHASE_COMPILE);
-        global_t::compile_all();
-
+        // Every parallel phase shares the same threads.
+        if(compiler_options().num_threads > 1)
+            start_thread_pool(compiler_options().num_threads);
 
+        if(compiler_options().watch)
+            watch();
+        else
+            compile_program(
+                std::vector<bool>(source_file_names.size(), true), false);
 
         //for(unsigned i = 0; i < 1; ++i)
         //{
@@ -0,0 +1,177 @@
+#include "mem_report.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <iomanip>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#include "atom.hpp"
+#include "globals.hpp"
+#include "gvar_set.hpp"
+#include "phase.hpp"
+#include "types.hpp"
+
+namespace
+{
+    char const* const pool_names[] =
+    {
+#define X(x) #x,
+        MEM_POOL_XENUM
+#undef X
+    };
+
+    char const* const phase_names[NUM_COMPILER_PHASES] =
+        { "init", "parse", "order globals", "compile" };
+
+    std::atomic<std::size_t> high_water[NUM_MEM_POOLS];
+
+    // Allocations are counted per phase in shards, so that threads
+    // rarely share a cache line.
+    struct alignas(64) alloc_shard_t
+    {
+        std::atomic<std::size_t> allocs[NUM_COMPILER_PHASES];
+        std::atomic<std::size_t> bytes[NUM_COMPILER_PHASES];
+    };
+
+    constexpr unsigned num_alloc_shards = 64;
+    alloc_shard_t alloc_shards[num_alloc_shards];
+    std::atomic<unsigned> next_alloc_shard = 0;
+
+    // These are constant-initialized, so 'operator new' can use them
+    // from the moment a thread starts.
+    thread_local unsigned alloc_shard_i = ~0u;
+    thread_local std::size_t thread_allocs = 0;
+    thread_local std::size_t thread_bytes = 0;
+
+    void count_alloc(std::size_t size)
+    {
+        if(alloc_shard_i == ~0u)
+            alloc_shard_i = next_alloc_shard++ % num_alloc_shards;
+
+        alloc_shard_t& shard = alloc_shards[alloc_shard_i];
+        compiler_phase_t const phase = compiler_phase();
+        shard.allocs[phase].fetch_add(1, std::memory_order_relaxed);
+        shard.bytes[phase].fetch_add(size, std::memory_order_relaxed);
+
+        ++thread_allocs;
+        thread_bytes += size;
+    }
+
+    struct global_allocs_t
+    {
+        std::string_view name;
+        std::size_t allocs;
+        std::size_t bytes;
+    };
+
+    std::mutex global_allocs_mutex; // Protects the object below:
+    std::vector<global_allocs_t> global_allocs;
+
+    double to_kib(std::size_t bytes) { return bytes / 1024.0; }
+} // end anon namespace
+
+// Every allocation of the program passes through these.
+void* operator new(std::size_t size)
+{
+    if(mem_report_enabled)
+        count_alloc(size);
+    if(void* ptr = std::malloc(size ? size : 1))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+void record_high_water(mem_pool_t pool, std::size_t bytes)
+{
+    std::atomic<std::size_t>& mark = high_water[pool];
+    std::size_t prev = mark.load(std::memory_order_relaxed);
+    while(prev < bytes && !mark.compare_exchange_weak(prev, bytes))
+        continue;
+}
+
+mem_global_t::mem_global_t(std::string_view name)
+: m_name(name)
+, m_allocs(thread_allocs)
+, m_bytes(thread_bytes)
+{}
+
+mem_global_t::~mem_global_t()
+{
+    if(!mem_report_enabled)
+        return;
+    global_allocs_t const allocs =
+        { m_name, thread_allocs - m_allocs, thread_bytes - m_bytes };
+    std::lock_guard<std::mutex> lock(global_allocs_mutex);
+    global_allocs.push_back(allocs);
+}
+
+void write_mem_report(std::ostream& o)
+{
+    // The tables only grow until the next build, so they're at their
+    // fullest now.
+    mem_high_water(MEM_atom_table, atom_memory_size());
+    mem_high_water(MEM_global_table, global_t::table_memory_size());
+    mem_high_water(MEM_type_tail_table, type_t::tails_memory_size());
+    mem_high_water(MEM_gvar_set_table, gvar_set_t::pool_memory_size());
+
+    o << std::fixed << std::setprecision(1);
+    o << "Memory report:\n";
+    o << "  High-water marks (per thread for thread-local pools):\n";
+    for(unsigned i = 0; i < NUM_MEM_POOLS; ++i)
+        o << "    " << std::left << std::setw(24) << pool_names[i]
+          << std::right << std::setw(12) << to_kib(high_water[i])
+          << " KiB\n";
+
+    o << "  Heap allocations per phase:\n";
+    for(unsigned phase = 0; phase < NUM_COMPILER_PHASES; ++phase)
+    {
+        std::size_t allocs = 0;
+        std::size_t bytes = 0;
+        for(alloc_shard_t const& shard : alloc_shards)
+        {
+            allocs += shard.allocs[phase];
+            bytes += shard.bytes[phase];
+        }
+        o << "    " << std::left << std::setw(24) << phase_names[phase]
+          << std::right << std::setw(12) << allocs << " allocations, "
+          << to_kib(bytes) << " KiB\n";
+    }
+
+    // Only the globals that allocate the most are interesting.
+    constexpr std::size_t max_globals = 10;
+    std::vector<global_allocs_t> sorted = global_allocs;
+    std::sort(sorted.begin(), sorted.end(),
+              [](global_allocs_t const& a, global_allocs_t const& b) -> bool
+              {
+                  return a.bytes > b.bytes;
+              });
+    if(sorted.size() > max_globals)
+        sorted.resize(max_globals);
+
+    o << "  Heap allocations of the globals allocating the most:\n";
+    for(global_allocs_t const& allocs : sorted)
+        o << "    " << std::left << std::setw(24) << allocs.name
+          << std::right << std::setw(12) << allocs.allocs
+          << " allocations, " << to_kib(allocs.bytes) << " KiB\n";
+
+    o << std::defaultfloat;
+}
+
+void reset_mem_report()
+{
+    for(auto& mark : high_water)
+        mark = 0;
+    for(alloc_shard_t& shard : alloc_shards)
+    {
+        for(auto& allocs : shard.allocs)
+            allocs = 0;
+        for(auto& bytes : shard.bytes)
+            bytes = 0;
+    }
+    global_allocs.clear();
+}
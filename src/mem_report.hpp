@@ -0,0 +1,74 @@
+#ifndef MEM_REPORT_HPP
+#define MEM_REPORT_HPP
+
+// Memory accounting for '--mem-report'.
+// Tracks the high-water marks of the compiler's pools and tables,
+// and counts heap allocations per phase and per global compiled.
+// When the report is disabled, recording costs a single branch.
+
+#include <cstddef>
+#include <ostream>
+#include <string_view>
+
+#define MEM_POOL_XENUM \
+    X(ssa_pool) \
+    X(cfg_pool) \
+    X(ssa_data_pool) \
+    X(cfg_data_pool) \
+    X(expr_pool) \
+    X(label_pool) \
+    X(locator_bitset_pool) \
+    X(liveness_bitset_pool) \
+    X(schedule_bitset_pool) \
+    X(sel_pool) \
+    X(atom_table) \
+    X(global_table) \
+    X(type_tail_table) \
+    X(gvar_set_table)
+
+enum mem_pool_t : unsigned char
+{
+#define X(x) MEM_##x,
+    MEM_POOL_XENUM
+#undef X
+    NUM_MEM_POOLS,
+};
+
+// Set once, before compiling, from the options.
+inline bool mem_report_enabled = false;
+
+void record_high_water(mem_pool_t pool, std::size_t bytes);
+
+// Notes that 'pool' holds 'bytes'.
+// Pools that get reused should be sampled once they're at their fullest.
+inline void mem_high_water(mem_pool_t pool, std::size_t bytes)
+{
+    if(mem_report_enabled)
+        record_high_water(pool, bytes);
+}
+
+// Attributes the heap allocations this thread makes while this exists
+// to a global. 'name' has to outlive the compile.
+class mem_global_t
+{
+public:
+    explicit mem_global_t(std::string_view name);
+    ~mem_global_t();
+
+    mem_global_t(mem_global_t const&) = delete;
+    mem_global_t& operator=(mem_global_t const&) = delete;
+private:
+    std::string_view m_name;
+    std::size_t m_allocs;
+    std::size_t m_bytes;
+};
+
+// Prints the high-water marks, then the allocations per phase and
+// those of the globals that allocated the most.
+// Call once compiling is done. This function isn't thread-safe.
+void write_mem_report(std::ostream& o);
+
+// Forgets everything recorded, for the next build.
+void reset_mem_report();
+
+#endif
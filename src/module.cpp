@@ -0,0 +1,134 @@
+#include "module.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#include "compiler_error.hpp"
+#include "format.hpp"
+#include "globals.hpp"
+#include "module_format.hpp"
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    global_t& lookup_undefined(std::string const& path, atom_ht name)
+    {
+        global_t& global = global_t::lookup(name, {});
+        if(global.gclass() != GLOBAL_UNDEFINED)
+        {
+            throw compiler_error_t(
+                fmt("Module % defines %, which is already defined.",
+                    path, global.name));
+        }
+        return global;
+    }
+
+    // Maps a set of var names to var indices.
+    gvar_set_t const& import_set(std::string const& path,
+                                 std::vector<atom_ht> const& names)
+    {
+        std::vector<unsigned> set;
+        for(atom_ht atom : names)
+        {
+            global_t const* var = global_t::find(atom);
+            if(!var || var->gclass() != GLOBAL_VAR)
+            {
+                throw compiler_error_t(
+                    fmt("Module % uses var %, which isn't defined. "
+                        "Import the module defining it first.",
+                        path, atom_name(atom)));
+            }
+            set.push_back(var->var().value);
+        }
+        return gvar_set_t::intern(set);
+    }
+
+    std::vector<atom_ht> export_set(gvar_set_t const& set)
+    {
+        std::vector<atom_ht> names;
+        set.for_each([&names](unsigned var)
+        {
+            names.push_back(global_t::get_var({ var }).atom);
+        });
+        return names;
+    }
+} // end anon namespace
+
+void import_module(std::string const& path)
+{
+    assert(compiler_phase() == PHASE_PARSE);
+
+    std::ifstream is(path, std::ios::binary);
+    if(!is.is_open())
+        throw std::runtime_error("Unable to open module: " + path);
+    module_t const module = decode_module(is, path);
+
+    // Vars come first, as the fns' summaries refer to them.
+    for(module_var_t const& var : module.vars)
+        lookup_undefined(path, var.name).import_var(var.type);
+
+    for(module_fn_t const& fn : module.fns)
+    {
+        lookup_undefined(path, fn.name).import_fn(
+            fn.type, import_set(path, fn.reads), import_set(path, fn.writes),
+            fn.io_pure);
+    }
+}
+
+void write_module(std::string const& path)
+{
+    assert(compiler_phase() == PHASE_COMPILE);
+
+    std::vector<global_t const*> globals;
+    global_t::for_each([&globals](global_t const& global)
+    {
+        if(global.imported())
+            return;
+        if(global.gclass() == GLOBAL_VAR
+           || (global.gclass() == GLOBAL_FN && global.compiled()))
+        {
+            globals.push_back(&global);
+        }
+    });
+
+    // Sort them, so that the same program always writes the same module.
+    std::sort(globals.begin(), globals.end(),
+              [](global_t const* a, global_t const* b) -> bool
+              {
+                  return a->name < b->name;
+              });
+
+    module_t module;
+    for(global_t const* global : globals)
+    {
+        if(global->gclass() == GLOBAL_VAR)
+            module.vars.push_back({ global->atom, global->type() });
+        else
+        {
+            fn_t const& fn = global->fn();
+            module.fns.push_back({ global->atom, global->type(),
+                                   fn.io_pure(), export_set(fn.reads()),
+                                   export_set(fn.writes()) });
+        }
+    }
+
+    // Encoding can fail, so do it before touching the file.
+    std::ostringstream encoded;
+    encode_module(encoded, module);
+
+    // Write to a temporary file first, so that a failed compile
+    // never leaves behind a partial module.
+    fs::path const tmp_path = path + ".tmp";
+    {
+        std::ofstream os(tmp_path, std::ios::binary);
+        os << encoded.str();
+        if(!os.is_open() || !os.good())
+            throw std::runtime_error("Unable to write module: " + path);
+    }
+    fs::rename(tmp_path, path);
+}
@@ -0,0 +1,25 @@
+#ifndef MODULE_HPP
+#define MODULE_HPP
+
+// Precompiled modules, written by '--emit-module' and read by '--module'.
+// A module holds what users of a library need without its source:
+// the name and type of each var and fn it defines, and each fn's
+// reads/writes/io_pure summaries.
+// Importing a module defines its globals as already compiled,
+// so only the importing program's own code gets parsed and compiled.
+//
+// Summaries can name vars from modules the library imported itself,
+// which have to be imported first.
+// The encoding itself is in 'module_format.hpp'.
+
+#include <string>
+
+// Defines the globals of a module.
+// Call during PHASE_PARSE, before parsing the source files.
+void import_module(std::string const& path);
+
+// Writes every var and compiled fn defined in the source files.
+// Call after 'compile_all'.
+void write_module(std::string const& path);
+
+#endif
@@ -0,0 +1,364 @@
+#include "module_format.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <iterator>
+#include <ostream>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "compiler_error.hpp"
+#include "format.hpp"
+
+namespace
+{
+    // Bump 'module_version' when the format changes.
+    constexpr char module_magic[8] = "MOSBOLM";
+    constexpr std::uint32_t module_version = 1;
+
+    // Types nested deeper than this are rejected, to bound the recursion
+    // decoding them.
+    constexpr unsigned max_type_depth = 64;
+
+    // The file starts with this, followed by the arrays it counts,
+    // in the order of its fields. Every array holds 32-bit words.
+    struct header_t
+    {
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t num_names;
+        std::uint32_t num_vars;
+        std::uint32_t num_fns;
+        std::uint32_t types_size;
+        std::uint32_t sets_size;
+        std::uint32_t strings_size; // In bytes.
+    };
+
+    // A name, as a slice of the string table.
+    struct name_record_t
+    {
+        std::uint32_t offset;
+        std::uint32_t size;
+    };
+
+    struct var_record_t
+    {
+        std::uint32_t name;
+        std::uint32_t type; // Index into 'types'.
+    };
+
+    // 'reads' and 'writes' are slices of 'sets', which holds names.
+    struct fn_record_t
+    {
+        std::uint32_t name;
+        std::uint32_t type;
+        std::uint32_t io_pure;
+        std::uint32_t reads;
+        std::uint32_t num_reads;
+        std::uint32_t writes;
+        std::uint32_t num_writes;
+    };
+
+    // Types are stored depth-first, each as a word holding the
+    // type's name and size, followed by the types in its tail.
+    std::uint32_t type_word(type_t type)
+    {
+        return type.name() | (type.size() << 8);
+    }
+
+    // Buffers and structs aren't listed, as they can't be stored.
+    unsigned tail_size(type_name_t name, unsigned size)
+    {
+        switch(name)
+        {
+        default:
+            return 0;
+        case TYPE_ARRAY:
+            return 1;
+        case TYPE_PTR:
+        case TYPE_FN:
+            return size;
+        }
+    }
+
+    bool can_encode(type_t type)
+    {
+        if(type.name() == TYPE_BUFFER || type.name() == TYPE_STRUCT)
+            return false;
+        unsigned const size = tail_size(type.name(), type.size());
+        for(unsigned i = 0; i < size; ++i)
+            if(!can_encode(type[i]))
+                return false;
+        return true;
+    }
+
+    struct module_writer_t
+    {
+        std::vector<name_record_t> names;
+        std::vector<var_record_t> vars;
+        std::vector<fn_record_t> fns;
+        std::vector<std::uint32_t> types;
+        std::vector<std::uint32_t> sets;
+        std::string strings;
+
+        std::unordered_map<std::uint32_t, std::uint32_t> name_map;
+
+        std::uint32_t add_name(atom_ht atom)
+        {
+            auto result = name_map.try_emplace(atom.value, names.size());
+            if(result.second)
+            {
+                std::string_view const name = atom_name(atom);
+                names.push_back({ strings.size(), name.size() });
+                strings += name;
+            }
+            return result.first->second;
+        }
+
+        std::uint32_t add_type(atom_ht name, type_t type)
+        {
+            if(!can_encode(type))
+            {
+                throw compiler_error_t(
+                    fmt("Unable to write % to a module, as its type holds "
+                        "a buffer or struct.", atom_name(name)));
+            }
+
+            std::uint32_t const index = types.size();
+            add_type_words(type);
+            return index;
+        }
+
+        void add_type_words(type_t type)
+        {
+            types.push_back(type_word(type));
+            unsigned const size = tail_size(type.name(), type.size());
+            for(unsigned i = 0; i < size; ++i)
+                add_type_words(type[i]);
+        }
+
+        std::uint32_t add_set(std::vector<atom_ht> const& set,
+                              std::uint32_t& size)
+        {
+            std::uint32_t const index = sets.size();
+            for(atom_ht atom : set)
+                sets.push_back(add_name(atom));
+            size = set.size();
+            return index;
+        }
+
+        void add(module_var_t const& var)
+        {
+            vars.push_back({ add_name(var.name),
+                             add_type(var.name, var.type) });
+        }
+
+        void add(module_fn_t const& fn)
+        {
+            fn_record_t record = {};
+            record.name = add_name(fn.name);
+            record.type = add_type(fn.name, fn.type);
+            record.io_pure = fn.io_pure;
+            record.reads = add_set(fn.reads, record.num_reads);
+            record.writes = add_set(fn.writes, record.num_writes);
+            fns.push_back(record);
+        }
+
+        template<typename T>
+        static void write_array(std::ostream& os, std::vector<T> const& vec)
+        {
+            os.write(reinterpret_cast<char const*>(vec.data()),
+                     vec.size() * sizeof(T));
+        }
+
+        void write(std::ostream& os) const
+        {
+            header_t header = {};
+            std::memcpy(header.magic, module_magic, sizeof(module_magic));
+            header.version = module_version;
+            header.num_names = names.size();
+            header.num_vars = vars.size();
+            header.num_fns = fns.size();
+            header.types_size = types.size();
+            header.sets_size = sets.size();
+            header.strings_size = strings.size();
+
+            os.write(reinterpret_cast<char const*>(&header), sizeof(header));
+            write_array(os, names);
+            write_array(os, vars);
+            write_array(os, fns);
+            write_array(os, types);
+            write_array(os, sets);
+            os.write(strings.data(), strings.size());
+        }
+    };
+
+    // Reads a module, checking that everything it refers to is in bounds.
+    class module_reader_t
+    {
+    public:
+        module_reader_t(std::istream& is, std::string const& path)
+        : m_path(path)
+        {
+            std::string const bytes(std::istreambuf_iterator<char>(is), {});
+            if(is.bad())
+                throw std::runtime_error("Unable to read module: " + path);
+
+            // Store it as words, to align the arrays.
+            m_words.resize((bytes.size() + 3) / 4);
+            bytes.copy(reinterpret_cast<char*>(m_words.data()), bytes.size());
+
+            char const* ptr = reinterpret_cast<char const*>(m_words.data());
+            char const* const end = ptr + bytes.size();
+
+            auto const take = [&](std::size_t bytes) -> char const*
+            {
+                if(std::size_t(end - ptr) < bytes)
+                    invalid();
+                char const* const taken = ptr;
+                ptr += bytes;
+                return taken;
+            };
+
+            header = reinterpret_cast<header_t const*>(
+                take(sizeof(header_t)));
+            if(std::memcmp(header->magic, module_magic, sizeof(module_magic))
+               || header->version != module_version)
+            {
+                throw std::runtime_error(
+                    "Not a module, or from another version: " + path);
+            }
+
+            names = reinterpret_cast<name_record_t const*>(
+                take(header->num_names * sizeof(name_record_t)));
+            vars = reinterpret_cast<var_record_t const*>(
+                take(header->num_vars * sizeof(var_record_t)));
+            fns = reinterpret_cast<fn_record_t const*>(
+                take(header->num_fns * sizeof(fn_record_t)));
+            types = reinterpret_cast<std::uint32_t const*>(
+                take(header->types_size * sizeof(std::uint32_t)));
+            sets = reinterpret_cast<std::uint32_t const*>(
+                take(header->sets_size * sizeof(std::uint32_t)));
+            strings = take(header->strings_size);
+        }
+
+        [[gnu::noreturn]] void invalid() const
+        {
+            throw std::runtime_error("Invalid module: " + m_path);
+        }
+
+        atom_ht name(std::uint32_t i) const
+        {
+            if(i >= header->num_names
+               || names[i].offset > header->strings_size
+               || names[i].size > header->strings_size - names[i].offset)
+            {
+                invalid();
+            }
+            return intern({ strings + names[i].offset, names[i].size });
+        }
+
+        type_t type(std::uint32_t& i, unsigned depth = 0) const
+        {
+            if(i >= header->types_size || depth > max_type_depth)
+                invalid();
+            type_name_t const name = type_name_t(types[i] & 0xFF);
+            unsigned const size = types[i] >> 8;
+            ++i;
+
+            // Each type in the tail takes at least one word.
+            unsigned const tail_words = tail_size(name, size);
+            if(tail_words > header->types_size - i)
+                invalid();
+
+            std::vector<type_t> tail(tail_words);
+            for(type_t& type : tail)
+                type = this->type(i, depth + 1);
+
+            switch(name)
+            {
+            case TYPE_ARRAY:
+                return type_t::array(tail[0], size);
+            case TYPE_PTR:
+                if(size != 1)
+                    invalid();
+                return type_t::ptr(tail[0]);
+            case TYPE_FN:
+                if(size == 0)
+                    invalid();
+                return type_t::fn(tail.data(), tail.data() + tail.size());
+            default:
+                // This rejects buffers and structs too.
+                if(size || name > TYPE_LARGEST_FIXED || is_composite(name))
+                    invalid();
+                return type_t(name);
+            }
+        }
+
+        std::vector<atom_ht> set(std::uint32_t begin,
+                                 std::uint32_t size) const
+        {
+            if(begin > header->sets_size || size > header->sets_size - begin)
+                invalid();
+
+            std::vector<atom_ht> set;
+            set.reserve(size);
+            for(std::uint32_t i = begin; i < begin + size; ++i)
+                set.push_back(name(sets[i]));
+            return set;
+        }
+
+        header_t const* header;
+        name_record_t const* names;
+        var_record_t const* vars;
+        fn_record_t const* fns;
+        std::uint32_t const* types;
+        std::uint32_t const* sets;
+        char const* strings;
+    private:
+        std::string m_path;
+        std::vector<std::uint32_t> m_words;
+    };
+} // end anon namespace
+
+void encode_module(std::ostream& os, module_t const& module)
+{
+    module_writer_t writer;
+    for(module_var_t const& var : module.vars)
+        writer.add(var);
+    for(module_fn_t const& fn : module.fns)
+        writer.add(fn);
+    writer.write(os);
+}
+
+module_t decode_module(std::istream& is, std::string const& path)
+{
+    module_reader_t const reader(is, path);
+    module_t module;
+
+    for(std::uint32_t i = 0; i < reader.header->num_vars; ++i)
+    {
+        var_record_t const& record = reader.vars[i];
+        std::uint32_t type_i = record.type;
+        module.vars.push_back({ reader.name(record.name),
+                                reader.type(type_i) });
+    }
+
+    for(std::uint32_t i = 0; i < reader.header->num_fns; ++i)
+    {
+        fn_record_t const& record = reader.fns[i];
+        std::uint32_t type_i = record.type;
+        module_fn_t fn;
+        fn.name = reader.name(record.name);
+        fn.type = reader.type(type_i);
+        if(fn.type.name() != TYPE_FN)
+            reader.invalid();
+        fn.io_pure = record.io_pure;
+        fn.reads = reader.set(record.reads, record.num_reads);
+        fn.writes = reader.set(record.writes, record.num_writes);
+        module.fns.push_back(std::move(fn));
+    }
+
+    return module;
+}
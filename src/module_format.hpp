@@ -0,0 +1,49 @@
+#ifndef MODULE_FORMAT_HPP
+#define MODULE_FORMAT_HPP
+
+// The encoding of modules, apart from the globals they define.
+// 'module.hpp' maps these to and from globals.
+//
+// The format is a header followed by flat arrays of 32-bit words and
+// a string table, so a module can be used straight from a mapping.
+// Summaries name vars rather than index them, as var indices depend on
+// what else the importing program defines.
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include "atom.hpp"
+#include "types.hpp"
+
+struct module_var_t
+{
+    atom_ht name;
+    type_t type;
+};
+
+struct module_fn_t
+{
+    atom_ht name;
+    type_t type;
+    bool io_pure;
+    // The names of the vars the fn reads and writes.
+    std::vector<atom_ht> reads;
+    std::vector<atom_ht> writes;
+};
+
+struct module_t
+{
+    std::vector<module_var_t> vars;
+    std::vector<module_fn_t> fns;
+};
+
+// Buffers and structs can't be written, as types can't be built from
+// them. Throws a 'compiler_error_t' naming the global using one.
+void encode_module(std::ostream& os, module_t const& module);
+
+// Throws if 'is' doesn't hold a valid module.
+// 'path' is only used in the errors.
+module_t decode_module(std::istream& is, std::string const& path);
+
+#endif
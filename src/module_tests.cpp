@@ -0,0 +1,105 @@
+#include "catch/catch.hpp"
+#include "module_format.hpp"
+
+#include <sstream>
+
+#include "compiler_error.hpp"
+
+namespace
+{
+    std::string encode(module_t const& module)
+    {
+        std::ostringstream os;
+        encode_module(os, module);
+        return os.str();
+    }
+
+    module_t decode(std::string const& bytes)
+    {
+        std::istringstream is(bytes);
+        return decode_module(is, "test");
+    }
+
+    module_t test_module()
+    {
+        type_t params[] = { TYPE_BYTE, type_t::ptr(TYPE_SHORT), TYPE_INT };
+        type_t const fn_type = type_t::fn(params, params + 3);
+        type_t no_params[] = { TYPE_VOID };
+        type_t const void_fn_type = type_t::fn(no_params, no_params + 1);
+
+        module_t module;
+        module.vars.push_back({ intern("a"), TYPE_BYTE });
+        module.vars.push_back({ intern("b"), TYPE_FIXED_12 });
+        module.vars.push_back({ intern("c"), type_t::array(TYPE_SHORT, 300) });
+        module.vars.push_back({ intern("d"), type_t::ptr(fn_type) });
+        module.fns.push_back({ intern("f"), fn_type, false,
+                               { intern("a"), intern("c") },
+                               { intern("c") } });
+        module.fns.push_back({ intern("g"), void_fn_type, true, {}, {} });
+        return module;
+    }
+} // end anon namespace
+
+TEST_CASE("module_round_trip", "[module]")
+{
+    module_t const module = test_module();
+    std::string const bytes = encode(module);
+    module_t const decoded = decode(bytes);
+
+    REQUIRE(decoded.vars.size() == module.vars.size());
+    for(unsigned i = 0; i < module.vars.size(); ++i)
+    {
+        REQUIRE(decoded.vars[i].name == module.vars[i].name);
+        REQUIRE(decoded.vars[i].type == module.vars[i].type);
+    }
+
+    REQUIRE(decoded.fns.size() == module.fns.size());
+    for(unsigned i = 0; i < module.fns.size(); ++i)
+    {
+        REQUIRE(decoded.fns[i].name == module.fns[i].name);
+        REQUIRE(decoded.fns[i].type == module.fns[i].type);
+        REQUIRE(decoded.fns[i].io_pure == module.fns[i].io_pure);
+        REQUIRE(decoded.fns[i].reads == module.fns[i].reads);
+        REQUIRE(decoded.fns[i].writes == module.fns[i].writes);
+    }
+
+    // Writing it back out gives the same bytes.
+    REQUIRE(encode(decoded) == bytes);
+}
+
+TEST_CASE("module_unencodable_types", "[module]")
+{
+    type_t params[] = { TYPE_BYTE, TYPE_SHORT, TYPE_VOID };
+    type_t const fn_type = type_t::fn(params, params + 3);
+
+    module_t module;
+    module.vars.push_back({ intern("s"), arg_struct(fn_type) });
+    REQUIRE_THROWS_AS(encode(module), compiler_error_t);
+
+    module.vars.clear();
+    module.vars.push_back({ intern("p"),
+                            type_t::ptr(arg_struct(fn_type)) });
+    REQUIRE_THROWS_AS(encode(module), compiler_error_t);
+}
+
+TEST_CASE("module_invalid", "[module]")
+{
+    std::string const bytes = encode(test_module());
+
+    // Truncated anywhere.
+    for(std::size_t size = 0; size < bytes.size(); size += 7)
+        REQUIRE_THROWS(decode(bytes.substr(0, size)));
+
+    // Not a module.
+    std::string other = bytes;
+    other[0] = 'X';
+    REQUIRE_THROWS(decode(other));
+
+    // Nested too deep to decode.
+    type_t type = TYPE_BYTE;
+    for(unsigned i = 0; i < 100; ++i)
+        type = type_t::ptr(type);
+    module_t deep;
+    deep.vars.push_back({ intern("deep"), type });
+    REQUIRE_THROWS(decode(encode(deep)));
+}
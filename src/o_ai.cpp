@@ -14,11 +14,11 @@
 #include "ir.hpp"
 #include "o_phi.hpp"
 #include "sizeof_bits.hpp"
+#include "trace.hpp"
 #include "worklist.hpp"
 
 namespace bc = ::boost::container;
 
-#include <iostream> // TODO
 #include <bitset> // TODO
 
 namespace {
@@ -194,31 +194,31 @@ ai_t::ai_t(ir_t& ir_) : ir(ir_)
 
     ir.assert_valid();
 
-    std::puts("TRACE");
+    TRACE(ai, "TRACE\n");
     insert_traces();
     ir.assert_valid();
 
-    std::puts("PROPAGATE");
+    TRACE(ai, "PROPAGATE\n");
     range_propagate();
     ir.assert_valid();
 
-    std::puts("PRUNE");
+    TRACE(ai, "PRUNE\n");
     prune_unreachable_code();
     ir.assert_valid();
 
-    std::puts("MARK SKIP");
+    TRACE(ai, "MARK SKIP\n");
     mark_skippable();
     ir.assert_valid();
 
-    std::puts("THREAD");
+    TRACE(ai, "THREAD\n");
     thread_jumps();
     ir.assert_valid();
     
-    std::puts("FOLD");
+    TRACE(ai, "FOLD\n");
     fold_consts();
     ir.assert_valid();
 
-    std::puts("REMOVE SKIP");
+    TRACE(ai, "REMOVE SKIP\n");
     remove_skippable();
     ir.assert_valid();
 }
@@ -608,7 +608,7 @@ void ai_t::compute_constraints(executable_index_t exec_i, ssa_ht ssa_node)
 // Performs range propagatation on a single SSA node.
 void ai_t::visit(ssa_ht ssa_node)
 {
-    std::cout << "visit " << to_string(ssa_node->op()) << '\n';
+    TRACE(ai, "visit " << to_string(ssa_node->op()) << '\n');
 
     if(ssa_node->op() == SSA_if)
     {
@@ -618,7 +618,7 @@ void ai_t::visit(ssa_ht ssa_node)
         assert(ssa_node->cfg_node()->output_size() == 2);
 
         constraints_t c = first_constraint(condition);
-        std::cout << "COND = " << c << '\n';
+        TRACE(ai, "COND = " << c << '\n');
 
         if(c.is_top())
             return;
@@ -660,9 +660,8 @@ void ai_t::visit(ssa_ht ssa_node)
             c.normalize();
     }
 
-    // TODO:
-    std::cout << "C = " << d.constraints()[0] << '\n';
-    std::cout << "O = " << old_constraints[0] << '\n';
+    TRACE(ai, "C = " << d.constraints()[0] << '\n'
+              << "O = " << old_constraints[0] << '\n');
 
     assert(all_normalized(d.constraints().vec));
     if(!bit_eq(d.constraints().vec, old_constraints))
@@ -732,7 +731,7 @@ void ai_t::range_propagate()
         while(!cfg_worklist.empty())
         {
             cfg_ht cfg_node = cfg_worklist.pop();
-            std::printf("CFG VISIT %i\n", cfg_node.index);
+            TRACE(ai, "CFG VISIT " << cfg_node.index << '\n');
             auto& d = ai_data(cfg_node);
 
             if(!d.executable[EXEC_PROPAGATE])
@@ -815,7 +814,7 @@ void ai_t::fold_consts()
     for(ssa_ht ssa_it = cfg_node.ssa_begin(); ssa_it; ++ssa_it)
     {
         if(ssa_it->op() == SSA_trace)
-            std::puts(" xx TRACe xx ");
+            TRACE(ai, "FOLD TRACE\n");
 
         if(ssa_it->output_size() == 0 || !has_constraints(ssa_it))
             continue;
@@ -826,10 +825,13 @@ void ai_t::fold_consts()
         if(is_numeric(ssa_it->type()) && d.constraints()[0].is_const())
         {
             fixed_t constant = { d.constraints()[0].get_const() };
-            std::cout << " FOLDING " << ssa_it->op() << ' ' << (constant.value >> fixed_t::shift) << ' ' << ssa_it->output_size() << '\n';
+            TRACE(ai, " FOLDING " << ssa_it->op() << ' '
+                      << (constant.value >> fixed_t::shift) << ' '
+                      << ssa_it->output_size() << '\n');
             if(ssa_it->replace_with(INPUT_VALUE, constant))
                 updated = true;
-            std::cout << " CONT " << ssa_it->op() << ' ' << ssa_it->output_size() << '\n';
+            TRACE(ai, " CONT " << ssa_it->op() << ' '
+                      << ssa_it->output_size() << '\n');
         }
         else if(op == SSA_eq || op == SSA_not_eq)
         {
@@ -1081,12 +1083,12 @@ void ai_t::thread_jumps()
             if(input.handle->output_size() != 2)
                 continue;
 
-            std::puts("running jump thread");
+            TRACE(ai, "running jump thread\n");
             run_jump_thread(input.handle, input.index);
         }
     }
 
-    std::cout << "THREADS: " << threaded_jumps.size() << '\n';
+    TRACE(ai, "THREADS: " << threaded_jumps.size() << '\n');
 
     if(threaded_jumps.size() == 0)
         return;
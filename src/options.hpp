@@ -3,11 +3,42 @@
 
 // Compiler options.
 
+#include <string>
+#include <vector>
+
 struct options_t
 {
     int num_threads = 1;
     bool optimize = false;
     bool graphviz = false;
+    bool mmap_files = true;
+    bool report_critical_path = false;
+    bool speculate = false;
+    bool report_reachability = false;
+    bool report_memory = false;
+    bool mem_report = false;
+
+    // Profiles each phase and pass, printing a summary and/or writing
+    // a Chrome trace.
+    bool time_report = false;
+    std::string trace_file;
+
+    // When not empty, compiled fns are cached in this directory.
+    std::string cache_dir;
+
+    // Keeps running, recompiling whenever an input file changes.
+    // The result of each build gets written to 'status_file', if set.
+    // This clears 'mmap_files', as files can change while mapped.
+    bool watch = false;
+    std::string status_file;
+
+    // Modules to import, and the module to write after compiling.
+    // Writing one needs every fn compiled, so not with 'entry_points'.
+    std::vector<std::string> modules;
+    std::string emit_module;
+
+    // When not empty, only globals reachable from these get compiled.
+    std::vector<std::string> entry_points;
 };
 
 extern options_t _options;
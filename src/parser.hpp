@@ -9,6 +9,9 @@
 // - Throws on error, which GREATLY simplifies the logic. 
 //   - Recovering from parse errors takes a lot of work and complexity. KISS!
 
+#include <cstdint>
+#include <vector>
+
 #include "compiler_error.hpp"
 #include "file.hpp"
 #include "parser_types.hpp"
@@ -27,6 +30,7 @@ private:
     char const* line_source = nullptr;
     char const* token_source = nullptr;
     char const* next_char = nullptr;
+    char const* end_char = nullptr; // Where the parsed range ends.
     token_t token = { TOK_ERROR };
     int indent = 0;
     unsigned line_number = 0;
@@ -34,6 +38,11 @@ private:
 public:
     parser_t() = delete;
     parser_t(Policy& policy, file_contents_t const& file);
+    // Parses only the range [begin, end) of the file.
+    // The range must begin at the start of a line, and end at 
+    // the start of a line or at the file's end.
+    parser_t(Policy& policy, file_contents_t const& file,
+             std::uint32_t begin, std::uint32_t end);
 
     void parse() { parse_top_level(); }
 
@@ -60,7 +69,7 @@ private:
     bool parse_indented_token();
     bool parse_line_ending();
 
-    pstring_t parse_ident();
+    ident_t parse_ident();
     expr_temp_t parse_expr();
     expr_temp_t parse_expr_then();
     void parse_expr(expr_temp_t&, int starting_indent, int open_parens);
@@ -103,4 +112,30 @@ void parse(file_contents_t& file)
     parser.parse();
 }
 
+// A range of a file that begins at a top-level definition,
+// allowing it to be parsed independently of the rest of the file.
+struct parse_chunk_t
+{
+    unsigned file_i;
+    std::uint32_t begin;
+    std::uint32_t end;
+};
+
+// Splits a file into chunks at the 'fn' and 'vars' definitions that start
+// at column 0. Chunks are merged until they're at least 'min_size' bytes.
+// Files whose first definition is indented aren't split at all.
+void split_top_level(file_contents_t const& file, std::size_t min_size,
+                     std::vector<parse_chunk_t>& chunks);
+
+// Files smaller than this aren't split for parsing.
+constexpr std::size_t min_parse_chunk_size = 16 * 1024;
+
+template<typename Policy>
+void parse(file_contents_t& file, parse_chunk_t chunk)
+{
+    Policy policy(file);
+    parser_t parser(policy, file, chunk.begin, chunk.end);
+    parser.parse();
+}
+
 #endif
@@ -0,0 +1,319 @@
+#include "catch/catch.hpp"
+#include "parser_impl.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+
+#include <unistd.h>
+
+namespace
+{
+    // Records what got parsed, as text.
+    // Everything is printed with its offset, to check that chunks
+    // produce the same offsets as a whole-file parse.
+    class record_t
+    {
+        struct nothing_t {};
+    public:
+        explicit record_t(file_contents_t const& file) : file(file) {}
+
+        std::string log;
+
+        var_decl_t begin_fn(ident_t fn_name, var_decl_t const* params_begin,
+                            var_decl_t const* params_end, type_t return_type)
+        {
+            add("fn", fn_name.pstring);
+            for(var_decl_t const* it = params_begin; it != params_end; ++it)
+                add("param", it->name);
+            return { TYPE_VOID, fn_name.pstring, fn_name.atom };
+        }
+
+        void end_fn(var_decl_t decl) { add("end_fn", decl.name); }
+
+        void global_var(var_decl_t const& var_decl, expr_temp_t* expr)
+        {
+            add("global", var_decl.name);
+            if(expr)
+                add(*expr);
+        }
+
+        void expr_statement(expr_temp_t& expr) { add(expr); }
+
+        void local_var(var_decl_t var_decl, expr_temp_t* expr)
+        {
+            add("local", var_decl.name);
+            if(expr)
+                add(*expr);
+        }
+
+        nothing_t begin_if(pstring_t pstring, expr_temp_t& condition)
+        {
+            add("if", pstring);
+            add(condition);
+            return {};
+        }
+
+        nothing_t end_if_begin_else(nothing_t, pstring_t pstring)
+        {
+            add("else", pstring);
+            return {};
+        }
+
+        void end_else(nothing_t) { log += "end_if\n"; }
+
+        nothing_t begin_do_while(pstring_t pstring)
+        {
+            add("do", pstring);
+            return {};
+        }
+
+        void end_do_while(nothing_t, pstring_t pstring,
+                          expr_temp_t& condition)
+        {
+            add("do_while", pstring);
+            add(condition);
+        }
+
+        nothing_t begin_while(pstring_t pstring, expr_temp_t& condition)
+        {
+            add("while", pstring);
+            add(condition);
+            return {};
+        }
+
+        void end_while(nothing_t) { log += "end_while\n"; }
+
+        expr_temp_t* begin_for(pstring_t pstring, var_decl_t* var_decl,
+                               expr_temp_t* init, expr_temp_t* condition,
+                               expr_temp_t* effect)
+        {
+            add("for", pstring);
+            return effect;
+        }
+
+        void end_for(expr_temp_t* effect) { log += "end_for\n"; }
+
+        void return_statement(pstring_t pstring, expr_temp_t* expr)
+        {
+            add("return", pstring);
+            if(expr)
+                add(*expr);
+        }
+
+        void break_statement(pstring_t pstring) { add("break", pstring); }
+
+        void continue_statement(pstring_t pstring)
+            { add("continue", pstring); }
+
+        void label_statement(ident_t ident) { add("label", ident.pstring); }
+
+        void goto_statement(ident_t ident) { add("goto", ident.pstring); }
+
+    private:
+        void add(char const* what, pstring_t pstring)
+        {
+            log += what;
+            log += ' ';
+            log += pstring.view(file.source());
+            log += " @";
+            log += std::to_string(pstring.offset);
+            log += '\n';
+        }
+
+        void add(expr_temp_t const& expr)
+        {
+            for(token_t const& token : expr)
+                add(token_name(token.type).data(), token.pstring);
+        }
+
+        file_contents_t const& file;
+    };
+
+    std::string const small_source =
+        "// A comment ahead of the definitions.\n"
+        "\n"
+        "vars\n"
+        "    byte a = 1\n"
+        "    byte b\n"
+        "\n"
+        "fn foo(byte x) byte\n"
+        "    a = x\n"
+        "    // Comment at column 4.\n"
+        "    if(x == 8)\n"
+        "        return x & b\n"
+        "    else\n"
+        "        return x | 3\n"
+        "\n"
+        "fn bar()\n"
+        "    byte i = 0\n"
+        "    while(i < 10)\n"
+        "        foo(i)\n"
+        "        i = i + 1\n"
+        "vars\n"
+        "    byte c = (a +\n"
+        "        b)\n";
+
+    // A definition on every few lines, so that chunks split often.
+    std::string large_source()
+    {
+        std::string source = "\n\n";
+        for(unsigned i = 0; source.size() < 3 * min_parse_chunk_size; ++i)
+        {
+            std::string const n = std::to_string(i);
+            source += "vars\n    byte v" + n + " = " + n + "\n";
+            source += "fn f" + n + "(byte x) byte\n";
+            source += "    byte y = x + v" + n + "\n";
+            source += "    for byte j = 0; j < y; j = j + 1\n";
+            source += "        if(j == 3)\n";
+            source += "            break\n";
+            source += "    return y\n\n";
+        }
+        return source;
+    }
+
+    // The first definition is indented, so the file can't be split.
+    std::string const indented_source =
+        "  fn foo()\n"
+        "      return\n"
+        "fn bar()\n"
+        "    return\n";
+
+    enum test_file_t
+    {
+        FILE_SMALL,
+        FILE_LARGE,
+        FILE_INDENTED,
+    };
+
+    // 'file_contents_t' loads from disk, so the sources are written to
+    // temporary files, which get removed at exit.
+    struct test_files_t
+    {
+        test_files_t()
+        {
+            std::string const sources[] =
+                { small_source, large_source(), indented_source };
+            first_file_i = source_file_names.size();
+            for(std::string const& source : sources)
+            {
+                char name[] = "/tmp/parser_tests_XXXXXX";
+                int const fd = mkstemp(name);
+                if(fd == -1)
+                    throw std::runtime_error("Unable to create test file.");
+                close(fd);
+                std::ofstream(name, std::ios::binary) << source;
+                names.push_back(name);
+                source_file_names.push_back(name);
+            }
+        }
+
+        ~test_files_t()
+        {
+            for(std::string const& name : names)
+                std::remove(name.c_str());
+        }
+
+        unsigned first_file_i;
+        std::vector<std::string> names;
+    };
+
+    file_contents_t test_file(test_file_t file)
+    {
+        static test_files_t const files;
+        return file_contents_t(files.first_file_i + file);
+    }
+
+    std::string parse_whole(file_contents_t const& file)
+    {
+        record_t record(file);
+        parser_t parser(record, file);
+        parser.parse();
+        return record.log;
+    }
+
+    std::string parse_chunks(file_contents_t const& file,
+                             std::vector<parse_chunk_t> const& chunks)
+    {
+        std::string log;
+        for(parse_chunk_t const& chunk : chunks)
+        {
+            record_t record(file);
+            parser_t parser(record, file, chunk.begin, chunk.end);
+            parser.parse();
+            log += record.log;
+        }
+        return log;
+    }
+
+    // Chunks have to tile the file, and begin at a definition.
+    void check_chunks(file_contents_t const& file,
+                      std::vector<parse_chunk_t> const& chunks)
+    {
+        REQUIRE(!chunks.empty());
+        REQUIRE(chunks.front().begin == 0);
+        REQUIRE(chunks.back().end == file.size());
+        for(unsigned i = 0; i < chunks.size(); ++i)
+        {
+            REQUIRE(chunks[i].file_i == file.index());
+            REQUIRE(chunks[i].begin < chunks[i].end);
+            if(i == 0)
+                continue;
+            REQUIRE(chunks[i].begin == chunks[i-1].end);
+            std::string_view const def(file.source() + chunks[i].begin, 5);
+            REQUIRE((def.substr(0, 3) == "fn " || def == "vars\n"));
+        }
+    }
+} // end anon namespace
+
+TEST_CASE("split_top_level_small", "[parser]")
+{
+    file_contents_t const file = test_file(FILE_SMALL);
+    REQUIRE(file.size() < min_parse_chunk_size);
+
+    std::vector<parse_chunk_t> chunks;
+    split_top_level(file, min_parse_chunk_size, chunks);
+    REQUIRE(chunks.size() == 1);
+    check_chunks(file, chunks);
+
+    // Splitting at every definition.
+    // The leading comment stays with the first one.
+    chunks.clear();
+    split_top_level(file, 1, chunks);
+    REQUIRE(chunks.size() == 4);
+    check_chunks(file, chunks);
+    REQUIRE(chunks[1].begin == small_source.find("fn foo"));
+    REQUIRE(chunks[2].begin == small_source.find("fn bar"));
+    REQUIRE(chunks[3].begin == small_source.rfind("vars"));
+
+    REQUIRE(parse_chunks(file, chunks) == parse_whole(file));
+}
+
+TEST_CASE("split_top_level_large", "[parser]")
+{
+    file_contents_t const file = test_file(FILE_LARGE);
+
+    std::vector<parse_chunk_t> chunks;
+    split_top_level(file, min_parse_chunk_size, chunks);
+    REQUIRE(chunks.size() >= 3);
+    check_chunks(file, chunks);
+    for(unsigned i = 0; i + 1 < chunks.size(); ++i)
+        REQUIRE(chunks[i].end - chunks[i].begin >= min_parse_chunk_size);
+
+    REQUIRE(parse_chunks(file, chunks) == parse_whole(file));
+
+    chunks.clear();
+    split_top_level(file, 100, chunks);
+    check_chunks(file, chunks);
+    REQUIRE(parse_chunks(file, chunks) == parse_whole(file));
+}
+
+TEST_CASE("split_top_level_indented", "[parser]")
+{
+    file_contents_t const file = test_file(FILE_INDENTED);
+
+    std::vector<parse_chunk_t> chunks;
+    split_top_level(file, 1, chunks);
+    REQUIRE(chunks.size() == 1);
+    check_chunks(file, chunks);
+}
@@ -9,6 +9,7 @@
 #include <boost/container/small_vector.hpp>
 
 #include "array_pool.hpp"
+#include "atom.hpp"
 #include "fixed.hpp"
 #include "lex_tables.hpp"
 #include "pstring.hpp"
@@ -27,6 +28,10 @@ struct token_t
 
     void set_ptr(void* ptr) { value = reinterpret_cast<int_type>(ptr); }
 
+    // The lexer stores the interned name of TOK_ident in 'value'.
+    // (Until pass1 replaces it.)
+    atom_ht atom() const { return { static_cast<std::uint32_t>(value) }; }
+
     template<typename T>
     T* ptr() const { return reinterpret_cast<T*>(value); }
 
@@ -34,10 +39,18 @@ struct token_t
     std::string to_string(char const* source) const;
 };
 
+// An identifier's location, along with its interned name.
+struct ident_t
+{
+    pstring_t pstring;
+    atom_ht atom;
+};
+
 struct var_decl_t
 {
     type_t type = TYPE_VOID;
     pstring_t name;
+    atom_ht atom;
 };
 
 using expr_temp_t = bc::small_vector<token_t, 16>;
@@ -9,14 +9,13 @@ token_t const* pass1_t::convert_expr(expr_temp_t& expr)
         // Lookup identifiers and replace their '.value' with an index.
         if(token.type == TOK_ident)
         {
-            if(unsigned const* handle = 
-               symbol_table.find(token.pstring.view(source())))
+            if(unsigned const* handle = symbol_table.find(token.atom()))
             {
                 token.value = *handle;
             }
             else
             {
-                global_t& g = global_t::lookup(token.pstring, source());
+                global_t& g = global_t::lookup(token.atom(), token.pstring);
                 token.type = TOK_global_ident;
                 token.set_ptr(&g);
                 ideps.insert(&g);
@@ -31,3 +30,5 @@ token_t const* pass1_t::convert_expr(expr_temp_t& expr)
     return global_t::new_expr(&*expr.begin(), &*expr.end());
 }
 
+#include "parser_impl.hpp"
+template class parser_t<pass1_t>;
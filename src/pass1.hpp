@@ -24,17 +24,14 @@ private:
     fn_def_t fn;
 
     symbol_table_t symbol_table;
-    fc::small_map<pstring_t, label_t*, 4, pstring_less_t>
-        label_map;
-    fc::small_multimap<pstring_t, stmt_ht, 4, pstring_less_t> 
+    fc::small_map<atom_ht, label_t*, 4, std::less<atom_ht>> label_map;
+    fc::small_multimap<atom_ht, stmt_ht, 4, std::less<atom_ht>>
         unlinked_gotos;
 
     struct nothing_t {};
 public:
     explicit pass1_t(file_contents_t const& file) 
     : file(file)
-    , label_map(pstring_less_t{ file.source() })
-    , unlinked_gotos(pstring_less_t{ file.source() })
     {}
 
     // Helpers
@@ -43,7 +40,7 @@ public:
 
     // Functions
     [[gnu::always_inline]]
-    var_decl_t begin_fn(pstring_t fn_name, var_decl_t const* params_begin, 
+    var_decl_t begin_fn(ident_t fn_name, var_decl_t const* params_begin, 
                         var_decl_t const* params_end, type_t return_type)
     {
         assert(ideps.empty());
@@ -54,7 +51,7 @@ public:
         fn = fn_def_t();
 
         // Find the global
-        active_global = &global_t::lookup(fn_name, source());
+        active_global = &global_t::lookup(fn_name.atom, fn_name.pstring);
 
         // Create a scope for the parameters.
         assert(symbol_table.empty());
@@ -64,7 +61,7 @@ public:
         fn.num_params = params_end - params_begin;
         for(unsigned i = 0; i < fn.num_params; ++i)
         {
-            symbol_table.new_def(i, params_begin[i].name.view(source()));
+            symbol_table.new_def(i, params_begin[i].atom);
             fn.local_vars.push_back(params_begin[i]);
         }
 
@@ -78,7 +75,7 @@ public:
         // Create a scope for the fn body.
         symbol_table.push_scope();
 
-        return { fn_type, fn_name };
+        return { fn_type, fn_name.pstring, fn_name.atom };
     }
 
     [[gnu::always_inline]]
@@ -93,7 +90,8 @@ public:
         if(!unlinked_gotos.empty())
         {
             auto it = unlinked_gotos.begin();
-            compiler_error(file, it->first, "Label not in scope.");
+            compiler_error(file, fn[it->second].pstring, 
+                           "Label not in scope.");
         }
 
         // Create the global:
@@ -106,7 +104,7 @@ public:
     void global_var(var_decl_t const& var_decl, expr_temp_t* expr)
     {
         assert(ideps.empty());
-        active_global = &global_t::lookup(var_decl.name, source());
+        active_global = &global_t::lookup(var_decl.atom, var_decl.name);
         active_global->define_var(var_decl.name, var_decl.type, 
                                   std::move(ideps));
     }
@@ -123,7 +121,7 @@ public:
         // Create the var.
         unsigned handle = fn.local_vars.size();
         if(unsigned const* existing = 
-           symbol_table.new_def(handle, var_decl.name.view(source())))
+           symbol_table.new_def(handle, var_decl.atom))
         {
             // Already have a variable defined in this scope.
             throw compiler_error_t(
@@ -255,26 +253,26 @@ public:
     }
 
     [[gnu::always_inline]]
-    void label_statement(pstring_t pstring)
+    void label_statement(ident_t ident)
     {
         // Create a new label
         label_t* label = global_t::new_label();
         label->stmt_h = fn.push_stmt(
-            { STMT_LABEL, pstring, { .label = label} });
+            { STMT_LABEL, ident.pstring, { .label = label} });
 
         // Add it to the label map
-        auto pair = label_map.emplace(pstring, label);
+        auto pair = label_map.emplace(ident.atom, label);
         if(!pair.second)
         {
             throw compiler_error_t(
-                fmt_error(file, pstring, "Label name already in use.")
-                + fmt_error(file, pair.first->first, 
+                fmt_error(file, ident.pstring, "Label name already in use.")
+                + fmt_error(file, fn[pair.first->second->stmt_h].pstring, 
                             "Previous definition here:"));
         }
 
         // Link up the unlinked gotos that jump to this label.
-        auto lower = unlinked_gotos.lower_bound(pstring);
-        auto upper = unlinked_gotos.upper_bound(pstring);
+        auto lower = unlinked_gotos.lower_bound(ident.atom);
+        auto upper = unlinked_gotos.upper_bound(ident.atom);
         for(auto it = lower; it < upper; ++it)
             fn[it->second].label = label;
         label->goto_count = std::distance(lower, upper);
@@ -282,16 +280,16 @@ public:
     }
 
     [[gnu::always_inline]]
-    void goto_statement(pstring_t pstring)
+    void goto_statement(ident_t ident)
     {
-        stmt_ht goto_h = fn.push_stmt({ STMT_GOTO, pstring });
+        stmt_ht goto_h = fn.push_stmt({ STMT_GOTO, ident.pstring });
 
-        auto it = label_map.find(pstring);
+        auto it = label_map.find(ident.atom);
         if(it == label_map.end())
         {
             // Label wasn't defined yet.
             // We'll fill in the jump_h once it is.
-            unlinked_gotos.emplace(pstring, goto_h);
+            unlinked_gotos.emplace(ident.atom, goto_h);
         }
         else
         {
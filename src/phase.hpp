@@ -1,9 +1,11 @@
 #ifndef PHASES_HPP
 #define PHASES_HPP
 
-// Tracks which phase the compiler is on, to mostly be used for debugging.
+// Tracks which phase the compiler is on, for debugging and for
+// attributing memory use.
 
 #include <atomic>
+#include <cassert>
 
 enum compiler_phase_t
 {
@@ -11,19 +13,25 @@ enum compiler_phase_t
     PHASE_PARSE,
     PHASE_ORDER_GLOBALS,
     PHASE_COMPILE,
+    NUM_COMPILER_PHASES,
 };
 
-#ifndef NDEBUG
 inline std::atomic<compiler_phase_t> _compiler_phase = PHASE_INIT;
-inline compiler_phase_t compiler_phase() { return _compiler_phase; }
-#endif
+inline compiler_phase_t compiler_phase() 
+{ 
+    return _compiler_phase.load(std::memory_order_relaxed); 
+}
 
 inline void set_compiler_phase(compiler_phase_t p) 
 { 
-#ifndef NDEBUG
     assert(p > _compiler_phase);
     _compiler_phase = p; 
-#endif
+}
+
+// Goes back to PHASE_INIT, to compile the program again.
+inline void reset_compiler_phase()
+{
+    _compiler_phase = PHASE_INIT;
 }
 
 #endif
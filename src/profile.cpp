@@ -0,0 +1,212 @@
+#include "profile.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+    using clock = std::chrono::steady_clock;
+
+    struct event_t
+    {
+        char const* name;
+        std::string_view global;
+        clock::time_point begin;
+        clock::time_point end;
+    };
+
+    struct thread_events_t
+    {
+        unsigned thread_i;
+        std::vector<event_t> events;
+    };
+
+    std::mutex buffers_mutex; // Protects the object below:
+    std::deque<thread_events_t> buffers;
+
+    thread_local thread_events_t* local_events = nullptr;
+    thread_local std::string_view local_global;
+
+    thread_events_t& this_thread_events()
+    {
+        if(!local_events)
+        {
+            std::lock_guard<std::mutex> lock(buffers_mutex);
+            local_events = &buffers.emplace_back();
+            local_events->thread_i = buffers.size() - 1;
+        }
+        return *local_events;
+    }
+
+    double to_ms(clock::duration d)
+    {
+        return std::chrono::duration<double, std::milli>(d).count();
+    }
+
+    double to_us(clock::duration d)
+    {
+        return std::chrono::duration<double, std::micro>(d).count();
+    }
+
+    void write_json_string(std::ostream& o, std::string_view str)
+    {
+        o << '"';
+        for(char c : str)
+        {
+            if(c == '"' || c == '\\')
+                o << '\\';
+            o << c;
+        }
+        o << '"';
+    }
+} // end anon namespace
+
+void profile_scope_t::record(char const* name, clock::time_point begin,
+                             clock::time_point end)
+{
+    this_thread_events().events.push_back({ name, local_global, begin, end });
+}
+
+profile_global_t::profile_global_t(std::string_view name)
+: m_prev(local_global)
+{
+    local_global = name;
+}
+
+profile_global_t::~profile_global_t()
+{
+    local_global = m_prev;
+}
+
+void write_time_report(std::ostream& o)
+{
+    struct total_t
+    {
+        unsigned calls = 0;
+        clock::duration total = {};
+        clock::duration max = {};
+    };
+
+    std::map<std::string_view, total_t> passes;
+    std::map<std::string_view, clock::duration> globals;
+    std::vector<std::pair<clock::duration, clock::duration>> threads;
+
+    for(thread_events_t const& buffer : buffers)
+    {
+        auto& [compiling, waiting] = threads.emplace_back();
+        for(event_t const& event : buffer.events)
+        {
+            clock::duration const d = event.end - event.begin;
+            total_t& total = passes[event.name];
+            ++total.calls;
+            total.total += d;
+            total.max = std::max(total.max, d);
+
+            // Scopes named "compile" span a global's whole compile,
+            // and "wait" is time spent waiting on the ready queue.
+            std::string_view const name = event.name;
+            if(name == "compile")
+            {
+                compiling += d;
+                globals[event.global] += d;
+            }
+            else if(name == "wait")
+                waiting += d;
+        }
+    }
+
+    std::vector<std::pair<std::string_view, total_t>> sorted(
+        passes.begin(), passes.end());
+    std::sort(sorted.begin(), sorted.end(),
+              [](auto const& a, auto const& b) -> bool
+              {
+                  return a.second.total > b.second.total;
+              });
+
+    o << "Time report:\n";
+    o << std::fixed << std::setprecision(3);
+    o << "  " << std::left << std::setw(28) << "scope" << std::right
+      << std::setw(8) << "calls" << std::setw(14) << "total ms"
+      << std::setw(12) << "max ms" << '\n';
+    for(auto const& [name, total] : sorted)
+    {
+        o << "  " << std::left << std::setw(28) << name << std::right
+          << std::setw(8) << total.calls
+          << std::setw(14) << to_ms(total.total)
+          << std::setw(12) << to_ms(total.max) << '\n';
+    }
+
+    o << "Threads:\n";
+    for(unsigned i = 0; i < threads.size(); ++i)
+        o << "  thread " << i << ": " << to_ms(threads[i].first)
+          << "ms compiling, " << to_ms(threads[i].second) << "ms waiting\n";
+
+    // Only the slowest globals are interesting.
+    constexpr std::size_t max_globals = 10;
+    std::vector<std::pair<std::string_view, clock::duration>> slowest(
+        globals.begin(), globals.end());
+    std::sort(slowest.begin(), slowest.end(),
+              [](auto const& a, auto const& b) -> bool
+              {
+                  return a.second > b.second;
+              });
+    if(slowest.size() > max_globals)
+        slowest.resize(max_globals);
+
+    o << "Slowest globals:\n";
+    for(auto const& [name, d] : slowest)
+        o << "  " << to_ms(d) << "ms " << name << '\n';
+
+    o << std::defaultfloat;
+}
+
+void write_trace(std::string const& path)
+{
+    std::ofstream o(path);
+    if(!o.is_open())
+        throw std::runtime_error("Unable to write trace: " + path);
+
+    clock::time_point start = clock::time_point::max();
+    for(thread_events_t const& buffer : buffers)
+        for(event_t const& event : buffer.events)
+            start = std::min(start, event.begin);
+
+    o << std::fixed << std::setprecision(3);
+    o << "{\"traceEvents\":[\n";
+    bool first = true;
+    for(thread_events_t const& buffer : buffers)
+    {
+        for(event_t const& event : buffer.events)
+        {
+            if(!first)
+                o << ",\n";
+            first = false;
+
+            o << "{\"name\":";
+            write_json_string(o, event.name);
+            o << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer.thread_i
+              << ",\"ts\":" << to_us(event.begin - start)
+              << ",\"dur\":" << to_us(event.end - event.begin);
+            if(!event.global.empty())
+            {
+                o << ",\"args\":{\"global\":";
+                write_json_string(o, event.global);
+                o << '}';
+            }
+            o << '}';
+        }
+    }
+    o << "\n]}\n";
+}
+
+void reset_profile()
+{
+    for(thread_events_t& buffer : buffers)
+        buffer.events.clear();
+}
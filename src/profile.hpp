@@ -0,0 +1,77 @@
+#ifndef PROFILE_HPP
+#define PROFILE_HPP
+
+// Compile-time profiling, enabled by '--time-report' and '--trace-file'.
+// Scopes record when each phase and pass ran, on which thread, and for
+// which global. Each thread records into its own buffer, so recording
+// takes no locks.
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+#include "options.hpp"
+
+inline bool profiling_enabled()
+{
+    return compiler_options().time_report
+           || !compiler_options().trace_file.empty();
+}
+
+// Records the time between its construction and destruction.
+// 'name' has to outlive the compile, so pass a string literal.
+class profile_scope_t
+{
+public:
+    explicit profile_scope_t(char const* name)
+    : m_name(profiling_enabled() ? name : nullptr)
+    {
+        if(m_name)
+            m_begin = std::chrono::steady_clock::now();
+    }
+
+    ~profile_scope_t()
+    {
+        if(m_name)
+            record(m_name, m_begin, std::chrono::steady_clock::now());
+    }
+
+    profile_scope_t(profile_scope_t const&) = delete;
+    profile_scope_t& operator=(profile_scope_t const&) = delete;
+private:
+    static void record(char const* name,
+                       std::chrono::steady_clock::time_point begin,
+                       std::chrono::steady_clock::time_point end);
+
+    char const* m_name;
+    std::chrono::steady_clock::time_point m_begin;
+};
+
+// Attributes the scopes that end while this exists to a global.
+// 'name' has to outlive the compile.
+class profile_global_t
+{
+public:
+    explicit profile_global_t(std::string_view name);
+    ~profile_global_t();
+
+    profile_global_t(profile_global_t const&) = delete;
+    profile_global_t& operator=(profile_global_t const&) = delete;
+private:
+    std::string_view m_prev;
+};
+
+// Prints the total time of each scope name, per thread, and per global.
+// These aren't thread-safe. Call once every scope has ended.
+void write_time_report(std::ostream& o);
+
+// Writes every scope as a Chrome trace event, viewable in
+// chrome://tracing or Perfetto.
+void write_trace(std::string const& path);
+
+// Forgets every recorded scope, for the next build.
+void reset_profile();
+
+#endif
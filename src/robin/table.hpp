@@ -381,6 +381,9 @@ public:
     std::size_t allocated_size() const
         { return hashes_end_ - hashes; }
 
+    std::size_t memory_size() const
+        { return allocated_size() * (sizeof(hash_type) + sizeof(value_type)); }
+
     std::size_t overhang() const
         { return allocated_size() > mask_ ? allocated_size() - (mask_+1) : 0; }
 
@@ -518,6 +521,7 @@ public:
     }
 
     std::size_t size() const { return used_size; }
+    std::size_t memory_size() const { return table.memory_size(); }
 private:
     hash_type calc_rehash_size() const
         { return (table.mask() + 1) * ratio_type::num / ratio_type::den; }
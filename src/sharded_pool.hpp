@@ -0,0 +1,118 @@
+#ifndef SHARDED_POOL_HPP
+#define SHARDED_POOL_HPP
+
+// A thread-safe, insert-only hash set that owns its elements.
+// Elements never move once created, so references to them stay valid
+// for the lifetime of the pool.
+//
+// The set is split into shards, each with its own lock, table, and storage.
+// The top bits of the hash pick the shard, so threads inserting different
+// keys rarely contend.
+
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+
+#include "robin/table.hpp"
+
+template<typename T, unsigned ShardBits = 6>
+class sharded_pool_t
+{
+public:
+    using hash_type = std::uint32_t;
+    static constexpr unsigned num_shards = 1 << ShardBits;
+
+    // Returns the element matching 'equals', creating it from 'args'
+    // if it doesn't exist yet.
+    // 'equals' is called as 'equals(T const&)'.
+    template<typename Eq, typename... Args>
+    T& emplace(hash_type hash, Eq const& equals, Args&&... args)
+    {
+        shard_t& shard = shards[shard_index(hash)];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return **shard.map.emplace(hash,
+            [&](T* ptr) -> bool { return equals(*ptr); },
+            [&]() -> T*
+            {
+                return &shard.pool.emplace_back(std::forward<Args>(args)...);
+            }).first;
+    }
+
+    // Returns the element matching 'equals', or nullptr if there isn't one.
+    template<typename Eq>
+    T* find(hash_type hash, Eq const& equals)
+    {
+        shard_t& shard = shards[shard_index(hash)];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        T* const* ptr = shard.map.find(hash,
+            [&](T* ptr) -> bool { return equals(*ptr); }).second;
+        return ptr ? *ptr : nullptr;
+    }
+
+    // This function is thread-safe, but the result is stale
+    // if inserts are still happening.
+    std::size_t size() const
+    {
+        std::size_t size = 0;
+        for(shard_t const& shard : shards)
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            size += shard.pool.size();
+        }
+        return size;
+    }
+
+    // The bytes held by the tables and pools, roughly.
+    std::size_t memory_size() const
+    {
+        std::size_t size = 0;
+        for(shard_t const& shard : shards)
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            size += shard.map.memory_size() + shard.pool.size() * sizeof(T);
+        }
+        return size;
+    }
+
+    // Destroys every element.
+    // This function isn't thread-safe.
+    void clear()
+    {
+        for(shard_t& shard : shards)
+        {
+            shard.map.clear();
+            shard.pool.clear();
+        }
+    }
+
+    // Calls 'fn' on every element, grouped by shard.
+    // This function isn't thread-safe.
+    template<typename Fn>
+    void for_each(Fn fn)
+    {
+        for(shard_t& shard : shards)
+            for(T& t : shard.pool)
+                fn(t);
+    }
+
+private:
+    static unsigned shard_index(hash_type hash)
+    {
+        if constexpr(ShardBits == 0)
+            return 0;
+        else
+            return hash >> (sizeof(hash_type) * 8 - ShardBits);
+    }
+
+    struct alignas(64) shard_t
+    {
+        mutable std::mutex mutex;
+        rh::robin_auto_table<T*> map;
+        std::deque<T> pool;
+    };
+
+    std::array<shard_t, num_shards> shards;
+};
+
+#endif
@@ -73,6 +73,7 @@ public:
 
     static std::size_t array_size() { return allocated_size; }
     static bool empty() { return allocated_size == 0; }
+    static std::size_t capacity_bytes() { return bytes_capacity; }
 
     template<typename T>
     struct scope_guard_t 
@@ -146,7 +147,8 @@ public:
         }
         else
         {
-            ret = { storage.size() };
+            using int_type = typename handle_t::int_type;
+            ret = { static_cast<int_type>(storage.size()) };
             storage.emplace_back();
         }
         ++used_size;
@@ -172,6 +174,8 @@ public:
 
     static std::size_t size() { return used_size; }
     static std::size_t array_size() { return storage.size(); }
+    static std::size_t capacity_bytes() 
+        { return storage.capacity() * sizeof(T); }
     static T* data() { return storage.data(); }
 };
 
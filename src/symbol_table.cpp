@@ -1,39 +1,36 @@
 #include "symbol_table.hpp"
 
 #include "compiler_error.hpp"
-#include "fnv1a.hpp"
 
-unsigned const* symbol_table_t::new_def(unsigned handle, std::string_view name)
+unsigned const* symbol_table_t::new_def(unsigned handle, atom_ht name)
 {
     assert(scope_stack.size() > 0);
 
-    hash_type hash = fnv1a<hash_type>::hash(name);
-    if(hash_counts[hash & table_mask] != 0)
+    if(hash_counts[slot(name)] != 0)
     {
         for(auto i = scope_stack.back(); i != assoc_list.size(); ++i)
-            if(assoc_list[i].hash == hash && assoc_list[i].name == name)
+            if(assoc_list[i].name == name)
                 return &assoc_list[i].handle;
     }
-    assoc_list.push_back({ name, hash, handle });
-    ++hash_counts[hash & table_mask];
-    if(hash_counts[hash & table_mask] == 0)
+    assoc_list.push_back({ name, handle });
+    ++hash_counts[slot(name)];
+    if(hash_counts[slot(name)] == 0)
         throw std::runtime_error("Symbol table overflow.");
 
     return nullptr;
 }
 
-unsigned const* symbol_table_t::find(std::string_view name) const
+unsigned const* symbol_table_t::find(atom_ht name) const
 {
     assert(scope_stack.size() > 0);
 
-    // Early exit if the table doesn't hold the hash.
-    hash_type hash = fnv1a<hash_type>::hash(name);
-    if(hash_counts[hash & table_mask] == 0)
+    // Early exit if the table doesn't hold the atom.
+    if(hash_counts[slot(name)] == 0)
         return nullptr;
 
     // Linear search backwards through 'assoc_list' to find a match.
     for(auto it = assoc_list.rbegin(); it != assoc_list.rend(); ++it)
-        if(it->hash == hash && it->name == name)
+        if(it->name == name)
             return &it->handle;
 
     return nullptr;
@@ -48,8 +45,8 @@ void symbol_table_t::pop_scope()
     scope_stack.pop_back();
     for(std::size_t i = new_size; i != old_size; ++i)
     {
-        assert(hash_counts[assoc_list[i].hash & table_mask] > 0);
-        --hash_counts[assoc_list[i].hash & table_mask];
+        assert(hash_counts[slot(assoc_list[i].name)] > 0);
+        --hash_counts[slot(assoc_list[i].name)];
     }
     assoc_list.resize(new_size);
 }
@@ -4,27 +4,26 @@
 #include <array>
 #include <cassert>
 #include <cstdint>
-#include <string_view>
 #include <vector>
 
 #include <boost/container/small_vector.hpp>
 
+#include "atom.hpp"
+
 namespace bc = boost::container;
 
 // Implements local-variable symbol tables as an association list.
 class symbol_table_t
 {
 public:
-    using hash_type = std::uint32_t;
-
     // Adds a local var to the table with handle 'handle'.
     // If the var already exists, return a pointer to its handle.
     // Otherwise, return nullptr.
-    unsigned const* new_def(unsigned handle, std::string_view name);
+    unsigned const* new_def(unsigned handle, atom_ht name);
 
     // Looks up a local var using 'name'.
     // Returns a pointer to the handle if found.
-    unsigned const* find(std::string_view name) const;
+    unsigned const* find(atom_ht name) const;
 
     void push_scope() { scope_stack.push_back(assoc_list.size()); }
     void pop_scope();
@@ -37,8 +36,7 @@ private:
 
     struct storage_t
     {
-        std::string_view name;
-        hash_type hash;
+        atom_ht name;
         unsigned handle;
     };
 
@@ -48,11 +46,13 @@ private:
     bc::small_vector<unsigned, 16> scope_stack;
     
     // Assoc lists are pretty damn slow to check if elements are NOT in them.
-    // To speed things up, count which hashes are contained in the assoc list
-    // using a fixed-size hash table. 
+    // To speed things up, count which atoms are contained in the assoc list
+    // using a fixed-size hash table.
     // A count of zero for an element's hash implies it's not in the container.
-    static constexpr std::size_t table_size = 1024; // Must be power of 2.
-    static constexpr hash_type table_mask = table_size - 1;
+    static constexpr unsigned table_bits = 10;
+    static constexpr std::size_t table_size = 1 << table_bits;
+    static unsigned slot(atom_ht atom) // Fibonacci hashing.
+        { return (atom.value * 2654435769u) >> (32 - table_bits); }
     std::array<unsigned char, table_size> hash_counts = {};
 };
 
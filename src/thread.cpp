@@ -0,0 +1,89 @@
+#include "thread.hpp"
+
+#include <cassert>
+#include <memory>
+#include <utility>
+
+namespace
+{
+    std::unique_ptr<thread_pool_t> pool;
+}
+
+thread_pool_t::thread_pool_t(unsigned num_threads)
+{
+    threads.reserve(num_threads);
+    for(unsigned i = 0; i < num_threads; ++i)
+        threads.emplace_back([this]{ work(); });
+}
+
+thread_pool_t::~thread_pool_t()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    cv.notify_all();
+    for(std::thread& thread : threads)
+        thread.join();
+}
+
+void thread_pool_t::submit(task_t task)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        tasks.push_back(std::move(task));
+    }
+    cv.notify_one();
+}
+
+void thread_pool_t::work()
+{
+    while(true)
+    {
+        task_t task;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            cv.wait(lock, [this]{ return stopping || !tasks.empty(); });
+            if(tasks.empty())
+                return;
+            task = std::move(tasks.front());
+            tasks.pop_front();
+        }
+        task();
+    }
+}
+
+void start_thread_pool(unsigned num_threads)
+{
+    assert(!pool);
+    pool.reset(new thread_pool_t(num_threads));
+}
+
+thread_pool_t& thread_pool()
+{
+    assert(pool);
+    return *pool;
+}
+
+task_group_t::~task_group_t()
+{
+    // Tasks reference the group, so they have to finish first.
+    cancel();
+    std::unique_lock<std::mutex> lock(mutex);
+    cv.wait(lock, [this]{ return pending == 0; });
+}
+
+void task_group_t::finish()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if(--pending == 0)
+        cv.notify_all();
+}
+
+void task_group_t::wait()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    cv.wait(lock, [this]{ return pending == 0; });
+    if(exception)
+        std::rethrow_exception(std::exchange(exception, nullptr));
+}
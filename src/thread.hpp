@@ -2,51 +2,121 @@
 #define THREAD_HPP
 
 #include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <exception>
+#include <functional>
+#include <mutex>
 #include <thread>
 #include <vector>
 
-// Launches a bunch of threads and waits until they finish.
-template<typename Fn>
-void parallelize(unsigned const num_threads, Fn fn)
+// A fixed set of worker threads that lives for the whole compile.
+// Reusing the same threads for every phase avoids paying thread startup
+// more than once, and keeps thread_local pools warm between phases.
+class thread_pool_t
 {
+public:
+    using task_t = std::function<void()>;
+
+    explicit thread_pool_t(unsigned num_threads);
+    ~thread_pool_t();
+
+    thread_pool_t(thread_pool_t const&) = delete;
+    thread_pool_t& operator=(thread_pool_t const&) = delete;
+
+    unsigned size() const { return threads.size(); }
+
+    // Queues 'task' to run on some worker.
+    // Tasks shouldn't throw; see 'task_group_t' for that.
+    void submit(task_t task);
+
+private:
+    void work();
+
     std::vector<std::thread> threads;
-    threads.reserve(num_threads);
 
-    std::vector<std::exception_ptr> exception_ptrs;
-    exception_ptrs.resize(num_threads, nullptr);
+    std::mutex mutex; // Protects the objects below:
+    std::condition_variable cv;
+    std::deque<task_t> tasks;
+    bool stopping = false;
+};
 
-    std::atomic<bool> exception_thrown = false;
+// Creates the process-wide pool. Call once, before using 'thread_pool'.
+void start_thread_pool(unsigned num_threads);
+thread_pool_t& thread_pool();
 
-    if(num_threads == 1)
-    {
-        fn(exception_thrown);
-        return;
-    }
+// Runs tasks on a pool and waits for them as a group.
+// If a task throws, the rest of the group is cancelled,
+// and the exception is rethrown by 'wait'.
+class task_group_t
+{
+public:
+    explicit task_group_t(thread_pool_t& pool) : pool(pool) {}
+    ~task_group_t();
 
-    for(unsigned i = 0; i < num_threads; ++i)
+    // Runs 'fn(cancelled)' on the pool.
+    // 'cancelled' gets set when the group is cancelled,
+    // and long-running tasks should poll it.
+    template<typename Fn>
+    void run(Fn fn)
     {
-        threads.emplace_back(
-        [fn, &exception_thrown](std::exception_ptr& exception_ptr)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ++pending;
+        }
+        pool.submit([this, fn]()
         {
             try
             {
-                fn(exception_thrown);
+                if(!cancelled)
+                    fn(cancelled);
             }
             catch(...)
             {
-                exception_ptr = std::current_exception();
-                exception_thrown = true;
+                std::lock_guard<std::mutex> lock(mutex);
+                if(!exception)
+                    exception = std::current_exception();
+                cancelled = true;
             }
-        }, std::ref(exception_ptrs[i]));
+            finish();
+        });
     }
 
-    for(unsigned i = 0; i < num_threads; ++i)
+    void cancel() { cancelled = true; }
+    bool is_cancelled() const { return cancelled; }
+
+    // Waits until every task has finished,
+    // then rethrows the first exception any of them threw.
+    void wait();
+
+private:
+    void finish();
+
+    thread_pool_t& pool;
+    std::atomic<bool> cancelled = false;
+
+    std::mutex mutex; // Protects the objects below:
+    std::condition_variable cv;
+    unsigned pending = 0;
+    std::exception_ptr exception;
+};
+
+// Runs 'fn' on 'num_threads' threads of the pool and waits until
+// they finish. Don't call this from inside a pool task.
+template<typename Fn>
+void parallelize(unsigned const num_threads, Fn fn)
+{
+    if(num_threads == 1)
     {
-        threads[i].join();
-        if(exception_ptrs[i])
-            std::rethrow_exception(exception_ptrs[i]);
+        std::atomic<bool> exception_thrown = false;
+        fn(exception_thrown);
+        return;
     }
+
+    task_group_t group(thread_pool());
+    for(unsigned i = 0; i < num_threads; ++i)
+        group.run(fn);
+    group.wait();
 }
 
 #endif
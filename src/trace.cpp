@@ -0,0 +1,84 @@
+#include "trace.hpp"
+
+#include <cstdio>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+    std::string_view const category_names[] =
+    {
+#define X(x) #x,
+        TRACE_XENUM
+#undef X
+    };
+
+    std::mutex stdout_mutex;
+
+    // Threads that exit with output left write it out then.
+    struct trace_buffer_t
+    {
+        std::ostringstream ss;
+        ~trace_buffer_t() { flush_trace(); }
+    };
+
+    thread_local trace_buffer_t buffer;
+} // end anon namespace
+
+std::ostream& trace_stream()
+{
+    return buffer.ss;
+}
+
+void flush_trace()
+{
+    std::string const str = buffer.ss.str();
+    if(str.empty())
+        return;
+    buffer.ss.str({});
+
+    std::lock_guard<std::mutex> lock(stdout_mutex);
+    std::fwrite(str.data(), 1, str.size(), stdout);
+    std::fflush(stdout);
+}
+
+std::uint32_t parse_trace_categories(std::string_view list)
+{
+    std::uint32_t mask = 0;
+    while(!list.empty())
+    {
+        std::size_t const comma = list.find(',');
+        std::string_view const name = list.substr(0, comma);
+        list = comma == std::string_view::npos 
+            ? std::string_view() : list.substr(comma + 1);
+
+        unsigned i = 0;
+        for(; i < NUM_TRACE_CATEGORIES; ++i)
+            if(category_names[i] == name)
+                break;
+        if(i == NUM_TRACE_CATEGORIES)
+            throw std::runtime_error(
+                "Unknown trace category: " + std::string(name) 
+                + " (expected " + std::string(trace_category_names()) + ")");
+        mask |= 1u << i;
+    }
+    return mask;
+}
+
+std::string_view trace_category_names()
+{
+    static std::string const names = []
+    {
+        std::string str;
+        for(std::string_view name : category_names)
+        {
+            if(!str.empty())
+                str += ',';
+            str += name;
+        }
+        return str;
+    }();
+    return names;
+}
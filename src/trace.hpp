@@ -0,0 +1,69 @@
+#ifndef TRACE_HPP
+#define TRACE_HPP
+
+// Debug output for '--trace', grouped into categories.
+// Each thread buffers its output, and writes it out once a global is
+// compiled, so threads don't contend on stdout or interleave lines.
+// When a category is disabled, tracing costs a single branch.
+
+#include <cstdint>
+#include <ostream>
+#include <string_view>
+
+#define TRACE_XENUM \
+    X(ai) \
+    X(coalesce) \
+    X(sched) \
+    X(isel) \
+    X(order) \
+    X(asm)
+
+enum trace_category_t : unsigned char
+{
+#define X(x) TRACE_##x,
+    TRACE_XENUM
+#undef X
+    NUM_TRACE_CATEGORIES,
+};
+
+// Set once, before compiling, from the options.
+inline std::uint32_t trace_mask = 0;
+
+inline bool trace_enabled(trace_category_t category)
+{
+    return __builtin_expect(trace_mask & (1u << category), false);
+}
+
+// This thread's buffer.
+std::ostream& trace_stream();
+
+// Writes this thread's buffer to stdout.
+void flush_trace();
+
+// Flushes this thread's buffer when it goes out of scope.
+struct trace_scope_t
+{
+    trace_scope_t() = default;
+    trace_scope_t(trace_scope_t const&) = delete;
+    trace_scope_t& operator=(trace_scope_t const&) = delete;
+    ~trace_scope_t() { if(trace_mask) flush_trace(); }
+};
+
+// Parses a comma-separated list of categories, like "ai,isel".
+// Throws if a name isn't a category.
+std::uint32_t parse_trace_categories(std::string_view list);
+
+// The names of every category, comma-separated.
+std::string_view trace_category_names();
+
+// Writes to the trace when 'category' is enabled, e.g.:
+//   TRACE(isel, "doing " << h->op() << '\n');
+#define TRACE(category, ...) \
+    do \
+    { \
+        if(trace_enabled(TRACE_##category)) \
+            trace_stream() << __VA_ARGS__; \
+    } \
+    while(false)
+
+#endif
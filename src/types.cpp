@@ -1,12 +1,52 @@
 #include "types.hpp"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 
 #include "robin/hash.hpp"
 
 using namespace std::literals;
 
-array_pool_t<type_t> type_t::tails;
+namespace
+{
+    struct map_elem_t
+    {
+        std::uint16_t size;
+        type_t const* tail;
+    };
+
+    // Tails are interned into shards, each with its own lock,
+    // so that threads building types rarely contend.
+    constexpr unsigned tail_shard_bits = 4;
+
+    struct alignas(64) tail_shard_t
+    {
+        std::mutex mutex; // Protects the objects below:
+        rh::robin_auto_table<map_elem_t> map;
+        array_pool_t<type_t> tails;
+    };
+
+    std::array<tail_shard_t, 1 << tail_shard_bits> tail_shards;
+
+    // Incremented by 'clear_all', to invalidate the thread-local caches.
+    std::atomic<unsigned> tail_generation = 0;
+
+    // Most types get built over and over again with the same tails,
+    // so each thread keeps a small direct-mapped cache of interned tails.
+    // A hit avoids taking any locks.
+    struct tail_cache_entry_t
+    {
+        std::size_t hash;
+        type_t const* tail;
+        std::uint16_t size;
+        unsigned generation;
+    };
+
+    constexpr unsigned tail_cache_size = 256; // Must be power of 2.
+    thread_local std::array<tail_cache_entry_t, tail_cache_size> 
+        tail_cache = {};
+} // end anon namespace
 
 type_t const* type_t::get_tail(type_t const& type)
 {
@@ -28,28 +68,60 @@ type_t const* type_t::get_tail(type_t const* begin, type_t const* end)
         hash = rh::hash_combine(hash, it->name());
         hash = rh::hash_combine(hash, tail_hasher(it->tail()));
     }
+    hash = rh::hash_finalize(hash);
+
+    // Interned tails are immutable, so the cache can compare against them
+    // without locking.
+    unsigned const generation = 
+        tail_generation.load(std::memory_order_acquire);
+    tail_cache_entry_t& entry = tail_cache[hash & (tail_cache_size - 1)];
+    if(entry.tail && entry.hash == hash && entry.size == size
+       && entry.generation == generation
+       && std::equal(begin, end, entry.tail))
+    {
+        return entry.tail;
+    }
 
-    std::lock_guard<std::mutex> const lock(tail_mutex);
+    tail_shard_t& shard = 
+        tail_shards[hash >> (sizeof(std::size_t) * CHAR_BIT - tail_shard_bits)];
+    std::lock_guard<std::mutex> const lock(shard.mutex);
 
-    rh::apair<map_elem_t*, bool> result = tail_map.emplace(
+    rh::apair<map_elem_t*, bool> result = shard.map.emplace(
         hash,
         [begin, end, size](map_elem_t elem) -> bool
         {
             return (elem.size == size && std::equal(begin, end, elem.tail));
         },
-        [begin, end, size]() -> map_elem_t
+        [begin, end, size, &shard]() -> map_elem_t
         { 
-            return { size, tails.insert(begin, end) };
+            return { size, shard.tails.insert(begin, end) };
         });
 
+    entry = { hash, result.first->tail, size, generation };
     return result.first->tail;
 }
 
+// This function isn't thread-safe with 'get_tail'.
 void type_t::clear_all()
 {
-    std::lock_guard<std::mutex> const lock(tail_mutex);
-    tail_map.clear();
-    tails.clear();
+    for(tail_shard_t& shard : tail_shards)
+    {
+        std::lock_guard<std::mutex> const lock(shard.mutex);
+        shard.map.clear();
+        shard.tails.clear();
+    }
+    tail_generation.fetch_add(1, std::memory_order_release);
+}
+
+std::size_t type_t::tails_memory_size()
+{
+    std::size_t size = 0;
+    for(tail_shard_t& shard : tail_shards)
+    {
+        std::lock_guard<std::mutex> const lock(shard.mutex);
+        size += shard.map.memory_size() + shard.tails.capacity_bytes();
+    }
+    return size;
 }
 
 type_t type_t::array(type_t elem_type, unsigned size)
@@ -119,6 +119,9 @@ public:
 
     static void clear_all();
 
+    // The bytes held by the interned tails.
+    static std::size_t tails_memory_size();
+
 private:
     type_name_t m_name = TYPE_VOID;
     // Overloaded; Holds tail size for fns and array size for arrays.
@@ -133,16 +136,6 @@ private:
 
     static type_t const* get_tail(type_t const& type);
     static type_t const* get_tail(type_t const* begin, type_t const* end);
-
-    struct map_elem_t
-    {
-        std::uint16_t size;
-        type_t const* tail;
-    };
-
-    inline static std::mutex tail_mutex; // Protects the objects below:
-    inline static rh::robin_auto_table<map_elem_t> tail_map;
-    static array_pool_t<type_t> tails;
 };
 
 inline bool operator==(type_t lhs, type_name_t rhs)
@@ -0,0 +1,130 @@
+#ifndef WORK_QUEUE_HPP
+#define WORK_QUEUE_HPP
+
+// A work-stealing priority queue for a fixed set of workers.
+//
+// Each worker owns a heap ordered by 'Less'. Workers push onto and pop
+// from their own heap, so work they produce tends to stay on the same
+// thread while it's cache-hot. When their heap runs dry, they steal the
+// highest priority work of the others' heaps.
+// Each heap has its own lock, which is uncontended unless it's being
+// stolen from.
+//
+// Idle workers park on an atomic counter of queued items, and are only
+// woken when there is work for them, rather than all at once.
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+template<typename T, typename Less = std::less<T>>
+class work_queue_t
+{
+public:
+    explicit work_queue_t(unsigned num_workers, Less less = Less())
+    : num_workers(num_workers)
+    , less(less)
+    , bins(new bin_t[num_workers])
+    {
+        assert(num_workers > 0);
+    }
+
+    // Adds work to 'worker_i's heap.
+    void push(unsigned worker_i, T t)
+    {
+        assert(worker_i < num_workers);
+        {
+            bin_t& bin = bins[worker_i];
+            std::lock_guard<std::mutex> lock(bin.mutex);
+            bin.heap.push_back(std::move(t));
+            std::push_heap(bin.heap.begin(), bin.heap.end(), less);
+        }
+        queued.fetch_add(1);
+        if(sleepers.load() > 0)
+            queued.notify_one();
+    }
+
+    // Takes work for 'worker_i', stealing if its own heap is empty
+    // and parking if there's no work anywhere.
+    // Returns false once the queue is closed.
+    bool pop(unsigned worker_i, T& t)
+    {
+        assert(worker_i < num_workers);
+        while(!closed.load())
+        {
+            if(try_pop(worker_i, t))
+                return true;
+
+            // Park until something gets pushed.
+            // 'sleepers' is incremented before 'queued' is checked,
+            // so a concurrent push either sees the sleeper and notifies,
+            // or is seen by the check.
+            // ('queued' can briefly dip below zero, as pushes count their
+            // work after publishing it.)
+            sleepers.fetch_add(1);
+            int const q = queued.load();
+            if(q <= 0 && !closed.load())
+                queued.wait(q);
+            sleepers.fetch_sub(1);
+        }
+        return false;
+    }
+
+    // Wakes every worker and makes 'pop' return false from now on.
+    void close()
+    {
+        closed.store(true);
+        queued.fetch_add(1);
+        queued.notify_all();
+    }
+
+    bool is_closed() const { return closed.load(); }
+
+    // Like 'pop', but returns false instead of waiting.
+    bool try_pop(unsigned worker_i, T& t)
+    {
+        // Our own work first, then the others'.
+        for(unsigned i = 0; i < num_workers; ++i)
+        {
+            bin_t& bin = bins[(worker_i + i) % num_workers];
+            std::lock_guard<std::mutex> lock(bin.mutex);
+            if(!bin.heap.empty())
+            {
+                std::pop_heap(bin.heap.begin(), bin.heap.end(), less);
+                t = std::move(bin.heap.back());
+                bin.heap.pop_back();
+                queued.fetch_sub(1);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Restores the heaps after the priorities of queued items changed.
+    // This function isn't thread-safe.
+    void reprioritize()
+    {
+        for(unsigned i = 0; i < num_workers; ++i)
+            std::make_heap(bins[i].heap.begin(), bins[i].heap.end(), less);
+    }
+
+private:
+    struct alignas(64) bin_t
+    {
+        std::mutex mutex;
+        std::vector<T> heap;
+    };
+
+    unsigned const num_workers;
+    Less const less;
+    std::unique_ptr<bin_t[]> bins;
+    std::atomic<int> queued = 0;
+    std::atomic<unsigned> sleepers = 0;
+    std::atomic<bool> closed = false;
+};
+
+#endif
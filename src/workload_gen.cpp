@@ -0,0 +1,369 @@
+// Generates synthetic MOSBOL programs for benchmarking the compiler.
+// The programs are deterministic for a given seed, and shaped by:
+//
+//   --fns N          number of fns
+//   --vars N         number of global vars
+//   --files N        number of files to spread them over
+//   --depth N        depth of the call graph
+//   --fanout N       calls each fn makes to the next level down
+//   --stmts N        statements per fn, roughly
+//   --loop-depth N   deepest nesting of loops
+//   --branches P     percent of statements that branch
+//   --fixed P        percent of fns using multi-byte fixed types
+//   --seed N
+//
+// Usage: workload_gen [options] output_dir
+// Writes output_dir/0.mos, output_dir/1.mos, ...
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace
+{
+    struct params_t
+    {
+        unsigned fns = 1000;
+        unsigned vars = 200;
+        unsigned files = 8;
+        unsigned depth = 8;
+        unsigned fanout = 3;
+        unsigned stmts = 20;
+        unsigned loop_depth = 2;
+        unsigned branches = 20;
+        unsigned fixed = 20;
+        std::uint64_t seed = 1;
+    };
+
+    struct rng_t
+    {
+        std::uint64_t state;
+
+        unsigned operator()(unsigned n)
+        {
+            state = state * 6364136223846793005ull + 1442695040888963407ull;
+            return n ? (state >> 33) % n : 0;
+        }
+
+        bool percent(unsigned p) { return (*this)(100) < p; }
+    };
+
+    // Single byte types, and the multi-byte fixed point ones.
+    char const* const byte_types[] = { "byte", "short", "int" };
+    char const* const fixed_types[] =
+        { "fixed11", "fixed12", "fixed21", "fixed22" };
+
+    struct fn_info_t
+    {
+        unsigned level;
+        unsigned type;    // Index into 'types'.
+        unsigned params;
+        std::vector<unsigned> callees;
+    };
+
+    class generator_t
+    {
+    public:
+        explicit generator_t(params_t const& p)
+        : p(p)
+        , rng{ p.seed * 0x9e3779b97f4a7c15ull + 1 }
+        {
+            for(char const* type : byte_types)
+                types.push_back(type);
+            for(char const* type : fixed_types)
+                types.push_back(type);
+
+            for(unsigned i = 0; i < p.vars; ++i)
+                var_types.push_back(rng(types.size()));
+
+            // Fns are spread over the levels of the call graph.
+            // Each calls fns on the next level, so there's no recursion.
+            unsigned const levels = std::max(p.depth, 1u);
+            std::vector<std::vector<unsigned>> by_level(levels);
+            for(unsigned i = 0; i < p.fns; ++i)
+            {
+                fn_info_t fn;
+                fn.level = i * levels / std::max(p.fns, 1u);
+                fn.type = rng.percent(p.fixed)
+                    ? std::size(byte_types) + rng(std::size(fixed_types))
+                    : rng(std::size(byte_types));
+                fn.params = 1 + rng(3);
+                by_level[fn.level].push_back(i);
+                fns.push_back(fn);
+            }
+
+            for(fn_info_t& fn : fns)
+            {
+                if(fn.level + 1 >= levels)
+                    continue;
+                auto const& next = by_level[fn.level + 1];
+                for(unsigned i = 0; i < p.fanout && !next.empty(); ++i)
+                    fn.callees.push_back(next[rng(next.size())]);
+            }
+        }
+
+        std::string gen_file(unsigned file_i)
+        {
+            std::string str;
+            if(file_i == 0 && p.vars)
+            {
+                str += "vars\n";
+                for(unsigned i = 0; i < p.vars; ++i)
+                    str += "    " + types[var_types[i]] + " " + var_name(i) + "\n";
+                str += "\n";
+            }
+
+            for(unsigned i = file_i; i < fns.size(); i += p.files)
+                gen_fn(str, i);
+            return str;
+        }
+
+    private:
+        params_t p;
+        rng_t rng;
+        std::vector<std::string> types;
+        std::vector<unsigned> var_types;
+        std::vector<fn_info_t> fns;
+
+        static std::string var_name(unsigned i) { return "g" + std::to_string(i); }
+        static std::string fn_name(unsigned i) { return "f" + std::to_string(i); }
+
+        // Picks a global var of 'type', if there is one nearby.
+        bool pick_var(unsigned type, unsigned& var_i)
+        {
+            if(var_types.empty())
+                return false;
+            unsigned const start = rng(var_types.size());
+            for(unsigned i = 0; i < 8; ++i)
+            {
+                var_i = (start + i) % var_types.size();
+                if(var_types[var_i] == type)
+                    return true;
+            }
+            return false;
+        }
+
+        std::string gen_operand(fn_info_t const& fn, unsigned num_locals)
+        {
+            switch(rng(4))
+            {
+            case 0:
+                return std::to_string(rng(200));
+            case 1:
+                {
+                    unsigned var_i;
+                    if(pick_var(fn.type, var_i))
+                        return var_name(var_i);
+                }
+                [[fallthrough]];
+            default:
+                return "l" + std::to_string(rng(num_locals));
+            }
+        }
+
+        std::string gen_expr(fn_info_t const& fn, unsigned num_locals,
+                             unsigned depth = 0)
+        {
+            static char const* const ops[] = { " + ", " - ", " & ", " | ", " ^ " };
+            if(depth >= 2 || rng(3) == 0)
+                return gen_operand(fn, num_locals);
+            return "(" + gen_expr(fn, num_locals, depth + 1)
+                   + ops[rng(std::size(ops))]
+                   + gen_expr(fn, num_locals, depth + 1) + ")";
+        }
+
+        std::string gen_cond(fn_info_t const& fn, unsigned num_locals)
+        {
+            static char const* const ops[] =
+                { " == ", " != ", " < ", " <= ", " > ", " >= " };
+            return gen_operand(fn, num_locals) + ops[rng(std::size(ops))]
+                   + gen_operand(fn, num_locals);
+        }
+
+        std::string gen_call(fn_info_t const& fn, unsigned callee_i,
+                             unsigned num_locals)
+        {
+            fn_info_t const& callee = fns[callee_i];
+            std::string str = fn_name(callee_i) + "(";
+            for(unsigned i = 0; i < callee.params; ++i)
+            {
+                if(i)
+                    str += ", ";
+                // Locals only match the callee's params when the types do.
+                if(callee.type == fn.type)
+                    str += gen_operand(fn, num_locals);
+                else
+                    str += std::to_string(rng(100));
+            }
+            return str + ")";
+        }
+
+        // Takes up to 'max' statements from 'budget' for a nested block.
+        unsigned take(unsigned& budget, unsigned max)
+        {
+            unsigned const taken = std::min(budget, 1 + rng(max));
+            budget -= taken;
+            return taken;
+        }
+
+        // Locals declared in a block go out of scope at its end,
+        // which is why 'num_locals' is passed by value.
+        void gen_block(std::string& str, fn_info_t const& fn,
+                       unsigned num_locals, unsigned indent,
+                       unsigned loop_depth, unsigned budget)
+        {
+            std::string const pad(indent * 4, ' ');
+            while(budget)
+            {
+                --budget;
+                unsigned var_i;
+                if(budget && rng.percent(p.branches))
+                {
+                    str += pad + "if " + gen_cond(fn, num_locals) + "\n";
+                    gen_block(str, fn, num_locals, indent + 1, loop_depth,
+                              take(budget, 4));
+                    if(budget && rng(2))
+                    {
+                        str += pad + "else\n";
+                        gen_block(str, fn, num_locals, indent + 1,
+                                  loop_depth, take(budget, 4));
+                    }
+                }
+                else if(budget && loop_depth < p.loop_depth && rng(6) == 0)
+                {
+                    std::string const i = "l" + std::to_string(num_locals);
+                    str += pad + "for " + types[fn.type] + " " + i + " = 0; "
+                           + i + " < " + std::to_string(1 + rng(50)) + "; "
+                           + i + " += 1\n";
+                    gen_block(str, fn, num_locals + 1, indent + 1,
+                              loop_depth + 1, take(budget, 6));
+                }
+                else if(!fn.callees.empty() && rng(4) == 0)
+                {
+                    unsigned const callee_i =
+                        fn.callees[rng(fn.callees.size())];
+                    str += pad;
+                    if(fns[callee_i].type == fn.type && rng(2))
+                        str += "l" + std::to_string(rng(num_locals)) + " = ";
+                    str += gen_call(fn, callee_i, num_locals) + "\n";
+                }
+                else if(rng(3) == 0 && pick_var(fn.type, var_i))
+                    str += pad + var_name(var_i) + " = "
+                           + gen_expr(fn, num_locals) + "\n";
+                else if(rng(3) == 0)
+                {
+                    str += pad + types[fn.type] + " l"
+                           + std::to_string(num_locals) + " = "
+                           + gen_expr(fn, num_locals) + "\n";
+                    ++num_locals;
+                }
+                else
+                    str += pad + "l" + std::to_string(rng(num_locals))
+                           + " = " + gen_expr(fn, num_locals) + "\n";
+            }
+        }
+
+        void gen_fn(std::string& str, unsigned fn_i)
+        {
+            fn_info_t const& fn = fns[fn_i];
+            std::string const& type = types[fn.type];
+
+            str += "fn " + fn_name(fn_i) + "(";
+            for(unsigned i = 0; i < fn.params; ++i)
+            {
+                if(i)
+                    str += ", ";
+                str += type + " l" + std::to_string(i);
+            }
+            str += ") " + type + "\n";
+
+            // The return only uses the params, as the block's locals
+            // are out of scope by then.
+            gen_block(str, fn, fn.params, 1, 0, std::max(p.stmts, 1u));
+            str += "    return " + gen_expr(fn, fn.params) + "\n\n";
+        }
+    };
+
+    [[noreturn]] void usage()
+    {
+        std::fprintf(stderr,
+            "Usage: workload_gen [--fns N] [--vars N] [--files N] "
+            "[--depth N] [--fanout N]\n"
+            "                    [--stmts N] [--loop-depth N] "
+            "[--branches P] [--fixed P]\n"
+            "                    [--seed N] output_dir\n");
+        std::exit(EXIT_FAILURE);
+    }
+} // end anon namespace
+
+int main(int argc, char** argv)
+{
+    params_t p;
+    char const* out_dir = nullptr;
+
+    struct option_t
+    {
+        char const* name;
+        unsigned* value;
+    };
+
+    unsigned seed = p.seed;
+    option_t const options[] =
+    {
+        { "--fns", &p.fns },
+        { "--vars", &p.vars },
+        { "--files", &p.files },
+        { "--depth", &p.depth },
+        { "--fanout", &p.fanout },
+        { "--stmts", &p.stmts },
+        { "--loop-depth", &p.loop_depth },
+        { "--branches", &p.branches },
+        { "--fixed", &p.fixed },
+        { "--seed", &seed },
+    };
+
+    for(int i = 1; i < argc; ++i)
+    {
+        option_t const* match = nullptr;
+        for(option_t const& option : options)
+            if(std::strcmp(argv[i], option.name) == 0)
+                match = &option;
+
+        if(match)
+        {
+            if(++i >= argc)
+                usage();
+            *match->value = std::strtoul(argv[i], nullptr, 10);
+        }
+        else if(!out_dir && argv[i][0] != '-')
+            out_dir = argv[i];
+        else
+            usage();
+    }
+
+    if(!out_dir || p.files == 0)
+        usage();
+    p.seed = seed;
+
+    generator_t gen(p);
+    for(unsigned i = 0; i < p.files; ++i)
+    {
+        std::string const path =
+            std::string(out_dir) + "/" + std::to_string(i) + ".mos";
+        std::ofstream os(path);
+        if(!os.is_open())
+        {
+            std::fprintf(stderr, "Unable to write %s.\n", path.c_str());
+            return EXIT_FAILURE;
+        }
+        os << gen.gen_file(i);
+    }
+
+    return EXIT_SUCCESS;
+}